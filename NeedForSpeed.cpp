@@ -9,10 +9,20 @@
 #include <freeglut.h>
 #include <glm/glm.hpp>
 
+#include "profiler.h"
+#include "simClock.h"
+
+#define SIM_RATE 30 // Simulation steps per second, independent of the frame rate.
+#define FRAME_RATE 60 // Frames drawn per second, above SIM_RATE so interpolation smooths the steps.
+
 static float speed = 1.0;   // a float to determine the speed of camera motion
 static float angleSpeed = 5.0 * M_PI / 180.0;   // determines the speed/test of camera rotation
 static float angle = 0.0;  // angle of camera rotation measured counter-clockwise with the -ve z axis
 static float xVal = 0, zVal = 0; // Co-ordinates of the spacecraft.
+static float prevXVal = 0, prevZVal = 0, prevAngle = 0.0; // Spacecraft before the last simulation step.
+static SimClock simClock(SIM_RATE); // Paces the fixed simulation steps.
+static int keyDown[4]; // Arrow keys held down: left, right, up, down.
+static int keyPressed[4]; // Arrow keys pressed since the last simulation step.
 
 // defining the eye, center and up vectors
 glm::vec3 eye = glm::vec3(0.0, 0.0, 0.2);
@@ -22,6 +32,13 @@ glm::vec3 up = glm::vec3(0.0, 1.0, 0.0);
 // Drawing routine.
 void drawScene(void)
 {
+    PROFILE_FUNCTION();
+    // spacecraft interpolated between the last two simulation steps
+    float alpha = simClock.alpha();
+    float carX = prevXVal + alpha * (xVal - prevXVal);
+    float carZ = prevZVal + alpha * (zVal - prevZVal);
+    float carAngle = prevAngle + alpha * (angle - prevAngle);
+
     // clearing the buffer and setting the drawing color
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -33,8 +50,8 @@ void drawScene(void)
 
     glPushMatrix();
     glColor3f(1.0, 0.0, 0.0);
-    glTranslatef(xVal, 0.0, zVal);
-    glRotatef(angle, 0.0, 1.0, 0.0);
+    glTranslatef(carX, 0.0, carZ);
+    glRotatef(carAngle, 0.0, 1.0, 0.0);
     glutSolidSphere(2.0, 15.0, 15.0);
     glPopMatrix();
 
@@ -63,18 +80,18 @@ void drawScene(void)
     glPopMatrix();
 
     // Locate the camera at the tip of the cone and pointing in the direction of the cone.
-    gluLookAt(xVal - 10 * sin((M_PI / 180.0) * angle),
+    gluLookAt(carX - 10 * sin((M_PI / 180.0) * carAngle),
               0.0,
-              zVal - 10 * cos((M_PI / 180.0) * angle),
-              xVal - 11 * sin((M_PI / 180.0) * angle),
+              carZ - 10 * cos((M_PI / 180.0) * carAngle),
+              carX - 11 * sin((M_PI / 180.0) * carAngle),
               0.0,
-              zVal - 11 * cos((M_PI / 180.0) * angle),
+              carZ - 11 * cos((M_PI / 180.0) * carAngle),
               0.0,
               1.0,
               0.0);
 
     // execute the drawing
-    glFlush();
+    glutSwapBuffers();
 }
 
 // Initialization routine.
@@ -188,29 +205,89 @@ void keyInput(unsigned char key, int x, int y)
     }
 }
 
-// Callback routine for non-ASCII key entry.
+// Function to map an arrow key to its index in keyDown, or -1 for other keys.
+int arrowKeyIndex(int key)
+{
+    if (key == GLUT_KEY_LEFT) return 0;
+    if (key == GLUT_KEY_RIGHT) return 1;
+    if (key == GLUT_KEY_UP) return 2;
+    if (key == GLUT_KEY_DOWN) return 3;
+    return -1;
+}
+
+// Callback routine for non-ASCII key entry. Held keys are applied by the simulation steps.
 void specialKeyInput(int key, int x, int y)
 {
+    int index = arrowKeyIndex(key);
+
+    if (index >= 0)
+    {
+        keyDown[index] = 1;
+        keyPressed[index] = 1;
+    }
+}
+
+// Callback routine for non-ASCII key release.
+void specialKeyUp(int key, int x, int y)
+{
+    int index = arrowKeyIndex(key);
+
+    if (index >= 0) keyDown[index] = 0;
+}
+
+// Function to advance the spacecraft by one fixed step.
+void simulationStep(void)
+{
+    PROFILE_FUNCTION();
+
+    prevXVal = xVal;
+    prevZVal = zVal;
+    prevAngle = angle;
+
     float tempxVal = xVal, tempzVal = zVal, tempAngle = angle;
 
-    // Compute next position.
-    if (key == GLUT_KEY_LEFT) tempAngle = angle + 5.0;
-    if (key == GLUT_KEY_RIGHT) tempAngle = angle - 5.0;
-    if (key == GLUT_KEY_UP)
+    // Compute next position from the keys held or tapped since the last step.
+    if (keyDown[0] || keyPressed[0]) tempAngle = tempAngle + 5.0;
+    if (keyDown[1] || keyPressed[1]) tempAngle = tempAngle - 5.0;
+    if (keyDown[2] || keyPressed[2])
     {
         tempxVal = xVal - sin(angle * M_PI / 180.0);
         tempzVal = zVal - cos(angle * M_PI / 180.0);
     }
-    if (key == GLUT_KEY_DOWN)
+    if (keyDown[3] || keyPressed[3])
     {
         tempxVal = xVal + sin(angle * M_PI / 180.0);
         tempzVal = zVal + cos(angle * M_PI / 180.0);
     }
+    for (int k = 0; k < 4; k++) keyPressed[k] = 0;
+
+    // Angle correction, keeping the previous angle on the same side of the wrap so
+    // interpolation turns the short way.
+    if (tempAngle > 360.0)
+    {
+        tempAngle -= 360.0;
+        prevAngle -= 360.0;
+    }
+    if (tempAngle < 0.0)
+    {
+        tempAngle += 360.0;
+        prevAngle += 360.0;
+    }
+
+    xVal = tempxVal;
+    zVal = tempzVal;
+    angle = tempAngle;
+}
+
+// Timer routine to run the simulation steps that are due and redraw, FRAME_RATE times a
+// second, leaving the CPU idle in between.
+void frameTimer(int value)
+{
+    int steps = simClock.advance();
 
-    // Angle correction.
-    if (tempAngle > 360.0) tempAngle -= 360.0;
-    if (tempAngle < 0.0) tempAngle += 360.0;
+    for (int k = 0; k < steps; k++) simulationStep();
     glutPostRedisplay();
+    glutTimerFunc(1000 / FRAME_RATE, frameTimer, 0);
 }
 
 // Main routine.
@@ -221,8 +298,9 @@ int main(int argc, char **argv)
     glutInitContextVersion(3, 3);
     glutInitContextProfile(GLUT_COMPATIBILITY_PROFILE);
 
-    // wanting an OpenGL context to support a single-buffered frame, each pixel having red, green, blue and alpha values.
-    glutInitDisplayMode(GLUT_SINGLE | GLUT_RGBA | GLUT_DEPTH);
+    // wanting an OpenGL context to support a double-buffered frame, each pixel having red, green, blue and alpha values.
+    // Frames are drawn continuously from the frame timer, so double buffering avoids flicker.
+    glutInitDisplayMode(GLUT_DOUBLE | GLUT_RGBA | GLUT_DEPTH);
 
     // set the initial size of the OpenGL window and the location of its top left corner on the computer screen
     glutInitWindowSize(500, 500);
@@ -236,6 +314,10 @@ int main(int argc, char **argv)
     glutReshapeFunc(resize);
     glutKeyboardFunc(keyInput);
     glutSpecialFunc(specialKeyInput);
+    glutSpecialUpFunc(specialKeyUp);
+    glutIgnoreKeyRepeat(1);
+    // runs the fixed simulation steps and requests a redraw FRAME_RATE times a second
+    glutTimerFunc(0, frameTimer, 0);
 
 
     // initializes GLEW (the OpenGL Extension Wrangler Library) which handles the loading of OpenGL extensions,
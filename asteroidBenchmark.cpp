@@ -0,0 +1,229 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Benchmark for the asteroid collision code of spaceTravel.cpp.
+//
+// Builds fields laid out like the game (rows 30 units apart, COLUMNS slots per row,
+// FILL_PROBABILITY percent of the slots filled) and times the car probe query
+// with the original linear scan over every slot, with the uniform grid testing one
+// asteroid at a time, and with the grid feeding the batch sphere kernel. Then times
+// the batch kernel on its own against its scalar fallback.
+//
+// Usage: asteroidBenchmark [asteroidCount ...]   (default: 50 10000 1000000)
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "asteroidField.h"
+#include "asteroidGrid.h"
+#include "sphereIntersection.h"
+
+#define COLUMNS 5
+#define FILL_PROBABILITY 50
+#define SIZE 10
+#define GRID_QUERIES 200000
+#define KERNEL_SPHERES 20000000 // Spheres tested per batch size in the kernel benchmark.
+
+// One row-column slot of the field; radius 0 marks an empty slot.
+struct Slot
+{
+    float x, y, z, radius;
+};
+
+// Car position and heading for one query.
+struct Probe
+{
+    float x, z, angle;
+};
+
+// Function to check if two spheres centered at (x1,y1,z1) and (x2,y2,z2) with
+// radius r1 and r2 intersect.
+static int checkSpheresIntersection(float x1, float y1, float z1, float r1,
+                                    float x2, float y2, float z2, float r2)
+{
+    return ((x1 - x2)*(x1 - x2) + (y1 - y2)*(y1 - y2) + (z1 - z2)*(z1 - z2) <= (r1 + r2)*(r1 + r2));
+}
+
+// Original CarCraftCollision(): every slot, heading recomputed per asteroid.
+static int linearCollision(const std::vector<Slot> &slots, float x, float z, float a)
+{
+    for (size_t k = 0; k < slots.size(); k++)
+        if (slots[k].radius > 0)
+            if (checkSpheresIntersection(x - 5 * sin((M_PI / 180.0) * a), 0.0,
+                                         z - 5 * cos((M_PI / 180.0) * a), 1.5,
+                                         slots[k].x, slots[k].y, slots[k].z, slots[k].radius))
+                return 1;
+    return 0;
+}
+
+// Grid version of CarCraftCollision() over the live asteroids.
+static int gridCollision(const AsteroidGrid &grid, const AsteroidField &field,
+                         float x, float z, float a)
+{
+    float probeX = x - 5 * sin((M_PI / 180.0) * a);
+    float probeZ = z - 5 * cos((M_PI / 180.0) * a);
+    const float *centerX = field.getCenterX(), *centerY = field.getCenterY();
+    const float *centerZ = field.getCenterZ(), *radius = field.getRadius();
+
+    return grid.query(probeX, probeZ, 1.5, [&](int k)
+    {
+        return checkSpheresIntersection(probeX, 0.0, probeZ, 1.5,
+                                        centerX[k], centerY[k], centerZ[k], radius[k]) != 0;
+    });
+}
+
+// CarCraftCollision() as in spaceTravel.cpp: grid runs fed to the batch kernel.
+static int batchCollision(const AsteroidGrid &grid, const AsteroidField &field,
+                          float x, float z, float a)
+{
+    float probeX = x - 5 * sin((M_PI / 180.0) * a);
+    float probeZ = z - 5 * cos((M_PI / 180.0) * a);
+    const float *centerX = field.getCenterX(), *centerY = field.getCenterY();
+    const float *centerZ = field.getCenterZ(), *radius = field.getRadius();
+
+    return grid.queryRanges(probeX, probeZ, 1.5, [&](int begin, int end)
+    {
+        return checkSpheresIntersectionBatch(probeX, 0.0, probeZ, 1.5, centerX + begin, centerY + begin,
+                                             centerZ + begin, radius + begin, end - begin) >= 0;
+    });
+}
+
+// Seconds elapsed since start.
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Routine to run both queries over a field of count asteroids and print the timings.
+static void runBenchmark(int count)
+{
+    std::vector<Slot> slots;
+    AsteroidField field;
+    int row = 0;
+
+    // Fill rows until the field holds count asteroids.
+    field.reserve(count);
+    while (field.getCount() < count)
+    {
+        for (int j = 0; j < COLUMNS && field.getCount() < count; j++)
+        {
+            Slot slot = { 0.0, 0.0, 0.0, 0.0 };
+            if (rand() % 100 < FILL_PROBABILITY)
+            {
+                slot.x = rand() % 60 - 30;
+                slot.y = -2.0;
+                slot.z = 80.0 - 30.0 * row;
+                slot.radius = SIZE;
+                field.add(slot.x, slot.y, slot.z, slot.radius, 0, 0, 0);
+            }
+            slots.push_back(slot);
+        }
+        row++;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    AsteroidGrid grid;
+    grid.build(field, 2.0 * SIZE);
+    double buildTime = secondsSince(start);
+
+    // Random car positions on the track.
+    std::vector<Probe> probes(GRID_QUERIES);
+    for (size_t k = 0; k < probes.size(); k++)
+    {
+        probes[k].x = rand() % 80 - 40;
+        probes[k].z = 120.0 - (rand() / (float)RAND_MAX) * (30.0 * row + 120.0);
+        probes[k].angle = rand() % 360;
+    }
+
+    // Keep the linear scan to a bounded amount of work on big fields.
+    int linearQueries = (int)(50000000.0 / slots.size());
+    if (linearQueries < 10) linearQueries = 10;
+    if (linearQueries > GRID_QUERIES) linearQueries = GRID_QUERIES;
+
+    int linearHits = 0, gridHits = 0, batchHits = 0, checkHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (int k = 0; k < linearQueries; k++)
+        linearHits += linearCollision(slots, probes[k].x, probes[k].z, probes[k].angle);
+    double linearTime = secondsSince(start) / linearQueries;
+
+    start = std::chrono::steady_clock::now();
+    for (int k = 0; k < GRID_QUERIES; k++)
+        gridHits += gridCollision(grid, field, probes[k].x, probes[k].z, probes[k].angle);
+    double gridTime = secondsSince(start) / GRID_QUERIES;
+
+    start = std::chrono::steady_clock::now();
+    for (int k = 0; k < GRID_QUERIES; k++)
+        batchHits += batchCollision(grid, field, probes[k].x, probes[k].z, probes[k].angle);
+    double batchTime = secondsSince(start) / GRID_QUERIES;
+
+    // Both must agree on the probes the linear scan saw.
+    for (int k = 0; k < linearQueries; k++)
+        checkHits += gridCollision(grid, field, probes[k].x, probes[k].z, probes[k].angle);
+
+    std::cout << count << " asteroids (" << slots.size() << " slots, "
+              << grid.getCellCount() << " cells, build " << buildTime * 1e3 << " ms)" << std::endl
+              << "  linear scan: " << linearTime * 1e9 << " ns/query" << std::endl
+              << "  grid:        " << gridTime * 1e9 << " ns/query, "
+              << gridHits << "/" << GRID_QUERIES << " hits" << std::endl
+              << "  grid+batch:  " << batchTime * 1e9 << " ns/query" << std::endl
+              << "  speedup:     " << linearTime / gridTime << "x grid, "
+              << linearTime / batchTime << "x grid+batch" << std::endl;
+    if (checkHits != linearHits || batchHits != gridHits)
+        std::cout << "  MISMATCH: linear " << linearHits << "/" << checkHits << " hits, grid "
+                  << gridHits << ", grid+batch " << batchHits << std::endl;
+}
+
+// Routine to time the batch kernel against its scalar fallback on runs of n spheres
+// that all miss the probe, so every sphere is tested.
+static void runKernelBenchmark(int n)
+{
+    AsteroidField field;
+    for (int k = 0; k < n; k++)
+        field.add(100.0 + rand() % 1000, -2.0, rand() % 1000, SIZE, 0, 0, 0);
+
+    const float *x = field.getCenterX(), *y = field.getCenterY();
+    const float *z = field.getCenterZ(), *r = field.getRadius();
+    int repeats = KERNEL_SPHERES / n, misses = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int k = 0; k < repeats; k++)
+        misses += checkSpheresIntersectionBatchScalar(k % 7, 0.0, 0.0, 1.5, x, y, z, r, n) < 0;
+    double scalarTime = secondsSince(start) / ((double)repeats * n);
+
+    start = std::chrono::steady_clock::now();
+    for (int k = 0; k < repeats; k++)
+        misses += checkSpheresIntersectionBatch(k % 7, 0.0, 0.0, 1.5, x, y, z, r, n) < 0;
+    double batchTime = secondsSince(start) / ((double)repeats * n);
+
+    std::cout << "  " << n << " spheres: scalar " << scalarTime * 1e9 << " ns/sphere, batch "
+              << batchTime * 1e9 << " ns/sphere, speedup " << scalarTime / batchTime << "x";
+    if (misses != 2 * repeats) std::cout << " (unexpected hits)";
+    std::cout << std::endl;
+}
+
+// Main routine.
+int main(int argc, char **argv)
+{
+    srand(1);
+    if (argc > 1)
+        for (int k = 1; k < argc; k++)
+            runBenchmark(atoi(argv[k]));
+    else
+    {
+        runBenchmark(50);
+        runBenchmark(10000);
+        runBenchmark(1000000);
+    }
+
+    std::cout << "Batch sphere kernel, " << sphereIntersectionPath() << ":" << std::endl;
+    runKernelBenchmark(4);
+    runKernelBenchmark(8);
+    runKernelBenchmark(16);
+    runKernelBenchmark(64);
+    runKernelBenchmark(1024);
+    return 0;
+}
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Structure-of-arrays store for the asteroids of spaceTravel.cpp.
+// See asteroidField.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "asteroidField.h"
+
+#define FIELD_ALIGNMENT 64 // Alignment of every array, enough for a cache line or a 16-float vector.
+
+// Round n up to a multiple of FIELD_ALIGNMENT.
+static size_t alignUp(size_t n)
+{
+    return (n + FIELD_ALIGNMENT - 1) & ~(size_t)(FIELD_ALIGNMENT - 1);
+}
+
+// Bytes taken by each float array and by the color array for capacity asteroids.
+static size_t floatArrayBytes(int capacity) { return alignUp(capacity * sizeof(float)); }
+static size_t colorArrayBytes(int capacity) { return alignUp(capacity * 4); }
+
+// Function to allocate a block for capacity asteroids.
+static void *allocateBlock(int capacity)
+{
+    void *block = malloc(4 * floatArrayBytes(capacity) + colorArrayBytes(capacity) + FIELD_ALIGNMENT);
+    if (block == NULL) abort();
+    return block;
+}
+
+// AsteroidField default constructor.
+AsteroidField::AsteroidField()
+{
+    count = 0;
+    capacity = 0;
+    block = spareBlock = NULL;
+    centerX = centerY = centerZ = radius = NULL;
+    color = NULL;
+}
+
+// AsteroidField destructor.
+AsteroidField::~AsteroidField()
+{
+    free(block);
+    free(spareBlock);
+}
+
+// Function to point the arrays into a block laid out for the current capacity.
+void AsteroidField::setArrays(void *newBlock)
+{
+    size_t floatBytes = floatArrayBytes(capacity);
+    unsigned char *base = (unsigned char *)alignUp((uintptr_t)newBlock);
+
+    block = newBlock;
+    centerX = (float *)base;
+    centerY = (float *)(base + floatBytes);
+    centerZ = (float *)(base + 2 * floatBytes);
+    radius = (float *)(base + 3 * floatBytes);
+    color = base + 4 * floatBytes;
+}
+
+// Function to grow the arrays, copying the asteroids over.
+void AsteroidField::reserve(int newCapacity)
+{
+    if (newCapacity <= capacity) return;
+
+    float *oldX = centerX, *oldY = centerY, *oldZ = centerZ, *oldRadius = radius;
+    unsigned char *oldColor = color;
+    void *oldBlock = block;
+
+    // Capacity is kept a multiple of 16 so vector loops can run over whole blocks.
+    capacity = (newCapacity + 15) & ~15;
+    setArrays(allocateBlock(capacity));
+    if (count > 0)
+    {
+        memcpy(centerX, oldX, count * sizeof(float));
+        memcpy(centerY, oldY, count * sizeof(float));
+        memcpy(centerZ, oldZ, count * sizeof(float));
+        memcpy(radius, oldRadius, count * sizeof(float));
+        memcpy(color, oldColor, count * 4);
+    }
+
+    free(oldBlock);
+    free(spareBlock);
+    spareBlock = NULL;
+}
+
+// Function to append an asteroid.
+int AsteroidField::add(float x, float y, float z, float r, unsigned char colorR,
+                       unsigned char colorG, unsigned char colorB)
+{
+    if (count == capacity) reserve(capacity > 0 ? 2 * capacity : 64);
+
+    centerX[count] = x;
+    centerY[count] = y;
+    centerZ[count] = z;
+    radius[count] = r;
+    color[4 * count] = colorR;
+    color[4 * count + 1] = colorG;
+    color[4 * count + 2] = colorB;
+    color[4 * count + 3] = 255;
+    return count++;
+}
+
+// Function to reorder the asteroids by scattering them into the spare block.
+void AsteroidField::permute(const int *destination)
+{
+    float *oldX = centerX, *oldY = centerY, *oldZ = centerZ, *oldRadius = radius;
+    const unsigned int *oldColor = (const unsigned int *)color;
+    void *oldBlock = block;
+
+    if (spareBlock == NULL) spareBlock = allocateBlock(capacity);
+    setArrays(spareBlock);
+    spareBlock = oldBlock;
+
+    unsigned int *newColor = (unsigned int *)color;
+    for (int k = 0; k < count; k++)
+    {
+        int d = destination[k];
+        centerX[d] = oldX[k];
+        centerY[d] = oldY[k];
+        centerZ[d] = oldZ[k];
+        radius[d] = oldRadius[k];
+        newColor[d] = oldColor[k];
+    }
+}
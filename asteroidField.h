@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Structure-of-arrays store for the asteroids of spaceTravel.cpp.
+//
+// Only live asteroids are stored, densely and in the order they were added. Every
+// attribute lives in its own 64-byte aligned array so that collision and drawing
+// loops stream through contiguous memory.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASTEROID_FIELD_H
+#define ASTEROID_FIELD_H
+
+class AsteroidField
+{
+public:
+    AsteroidField();
+    ~AsteroidField();
+
+    // Make room for at least capacity asteroids. Keeps the current asteroids.
+    void reserve(int capacity);
+
+    // Remove all asteroids. Keeps the storage.
+    void clear() { count = 0; }
+
+    // Append an asteroid and return its index.
+    int add(float x, float y, float z, float r, unsigned char colorR,
+            unsigned char colorG, unsigned char colorB);
+
+    // Move asteroid k to index destination[k]; destination must be a permutation.
+    void permute(const int *destination);
+
+    int getCount() const { return count; }
+    const float *getCenterX() const { return centerX; }
+    const float *getCenterY() const { return centerY; }
+    const float *getCenterZ() const { return centerZ; }
+    const float *getRadius() const { return radius; }
+    const unsigned char *getColor() const { return color; } // RGBA, 4 bytes per asteroid.
+
+private:
+    AsteroidField(const AsteroidField &);
+    AsteroidField &operator=(const AsteroidField &);
+
+    // Point the arrays into a block holding capacity asteroids.
+    void setArrays(void *newBlock);
+
+    int count, capacity;
+    void *block; // Single allocation holding all the arrays.
+    void *spareBlock; // Block of the same size kept for permute().
+    float *centerX, *centerY, *centerZ, *radius;
+    unsigned char *color;
+};
+
+#endif
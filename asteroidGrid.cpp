@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Static uniform grid over the XZ plane used as the broadphase for asteroid collision.
+// See asteroidGrid.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "asteroidGrid.h"
+
+// AsteroidGrid default constructor.
+AsteroidGrid::AsteroidGrid()
+{
+    minX = 0.0;
+    minZ = 0.0;
+    cellSize = 1.0;
+    invCellSize = 1.0;
+    maxRadius = 0.0;
+    cellsX = 0;
+    cellsZ = 0;
+}
+
+// Function to bin the asteroids into cells with a counting sort and reorder the field
+// to match.
+void AsteroidGrid::build(AsteroidField &field, float size)
+{
+    const float *x = field.getCenterX(), *z = field.getCenterZ(), *radius = field.getRadius();
+    int count = field.getCount();
+    int k;
+
+    cellStart.clear();
+    cellsX = cellsZ = 0;
+    maxRadius = 0.0;
+    if (count <= 0) return;
+
+    // Bounds of the asteroid centers.
+    float maxX = x[0], maxZ = z[0];
+    minX = x[0];
+    minZ = z[0];
+    for (k = 0; k < count; k++)
+    {
+        if (x[k] < minX) minX = x[k];
+        if (x[k] > maxX) maxX = x[k];
+        if (z[k] < minZ) minZ = z[k];
+        if (z[k] > maxZ) maxZ = z[k];
+        if (radius[k] > maxRadius) maxRadius = radius[k];
+    }
+
+    // Grow the cells until there are at most a few per asteroid.
+    double maxCells = 4.0 * count + 16.0;
+    cellSize = size > 0.0 ? size : 1.0;
+    while (((maxX - minX) / cellSize + 1.0) * ((maxZ - minZ) / cellSize + 1.0) > maxCells)
+        cellSize *= 2.0;
+    invCellSize = 1.0 / cellSize;
+    cellsX = (int)((maxX - minX) * invCellSize) + 1;
+    cellsZ = (int)((maxZ - minZ) * invCellSize) + 1;
+
+    // Count the asteroids in each cell and turn the counts into offsets.
+    cellOf.resize(count);
+    cellStart.assign(cellsX * cellsZ + 1, 0);
+    for (k = 0; k < count; k++)
+    {
+        int cx = (int)((x[k] - minX) * invCellSize);
+        int cz = (int)((z[k] - minZ) * invCellSize);
+        if (cx >= cellsX) cx = cellsX - 1;
+        if (cz >= cellsZ) cz = cellsZ - 1;
+        cellOf[k] = cz * cellsX + cx;
+        cellStart[cellOf[k] + 1]++;
+    }
+    for (k = 0; k < cellsX * cellsZ; k++)
+        cellStart[k + 1] += cellStart[k];
+
+    // Give each asteroid its slot after the ones of the preceding cells and move it there.
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (k = 0; k < count; k++)
+        cellOf[k] = cellCursor[cellOf[k]]++;
+    field.permute(cellOf.data());
+}
@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Static uniform grid over the XZ plane used as the broadphase for asteroid collision.
+//
+// Asteroids are binned once by their centers, and the field is reordered so that
+// the asteroids of each cell, and of each row of cells, are contiguous. A query for a
+// probe sphere only visits the cells the probe can reach when grown by the largest
+// asteroid radius, so its cost does not depend on the size of the field.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef ASTEROID_GRID_H
+#define ASTEROID_GRID_H
+
+#include <cmath>
+#include <vector>
+
+#include "asteroidField.h"
+#include "frustum.h"
+
+class AsteroidGrid
+{
+public:
+    AsteroidGrid();
+
+    // Bin the asteroids of field and sort the field by cell. The cell size is grown if
+    // needed to keep the number of cells proportional to the number of asteroids.
+    void build(AsteroidField &field, float cellSize);
+
+    // Call visit(index) for every asteroid whose cell the probe sphere at (x, z) with
+    // radius r can reach. Stops and returns true as soon as visit returns true.
+    template <typename Visitor>
+    bool query(float x, float z, float r, Visitor visit) const;
+
+    // Same as query() but calls visit(begin, end) once per row of reachable cells with
+    // the contiguous range of field indices they hold.
+    template <typename Visitor>
+    bool queryRanges(float x, float z, float r, Visitor visit) const;
+
+    // Call visit(begin, end, inside) with the contiguous field indices of every cell whose
+    // bounds, grown by the largest asteroid radius, pass testBounds(x0, z0, x1, z1). The
+    // test returns FRUSTUM_OUTSIDE, FRUSTUM_INTERSECTS or FRUSTUM_INSIDE; a row of cells
+    // is tested as a whole first and cells are only tested in rows that intersect.
+    // inside is true when every asteroid of the range is known to pass.
+    template <typename BoundsTest, typename Visitor>
+    void visitCells(BoundsTest testBounds, Visitor visit) const;
+
+    int getCellCount() const { return cellsX * cellsZ; }
+    float getCellSize() const { return cellSize; }
+
+private:
+    // Reachable cell block of a probe; false if it misses the grid.
+    bool cellRange(float x, float z, float r, int &x0, int &x1, int &z0, int &z1) const;
+
+    float minX, minZ; // Corner of the grid.
+    float cellSize, invCellSize;
+    float maxRadius; // Largest asteroid radius, used to grow queries.
+    int cellsX, cellsZ; // Number of cells along x and z.
+    std::vector<int> cellStart; // First field index of each cell, plus one end marker.
+    std::vector<int> cellOf; // Scratch: cell of each asteroid during build().
+    std::vector<int> cellCursor; // Scratch: next free slot of each cell during build().
+};
+
+template <typename Visitor>
+bool AsteroidGrid::query(float x, float z, float r, Visitor visit) const
+{
+    int x0, x1, z0, z1;
+    if (!cellRange(x, z, r, x0, x1, z0, z1)) return false;
+
+    for (int cz = z0; cz <= z1; cz++)
+        for (int k = cellStart[cz * cellsX + x0]; k < cellStart[cz * cellsX + x1 + 1]; k++)
+            if (visit(k)) return true;
+    return false;
+}
+
+template <typename Visitor>
+bool AsteroidGrid::queryRanges(float x, float z, float r, Visitor visit) const
+{
+    int x0, x1, z0, z1;
+    if (!cellRange(x, z, r, x0, x1, z0, z1)) return false;
+
+    for (int cz = z0; cz <= z1; cz++)
+    {
+        int begin = cellStart[cz * cellsX + x0], end = cellStart[cz * cellsX + x1 + 1];
+        if (begin < end && visit(begin, end)) return true;
+    }
+    return false;
+}
+
+template <typename BoundsTest, typename Visitor>
+void AsteroidGrid::visitCells(BoundsTest testBounds, Visitor visit) const
+{
+    float x0 = minX - maxRadius, x1 = minX + cellsX * cellSize + maxRadius;
+
+    for (int cz = 0; cz < cellsZ; cz++)
+    {
+        int row = cz * cellsX;
+        if (cellStart[row] == cellStart[row + cellsX]) continue;
+
+        float z0 = minZ + cz * cellSize - maxRadius, z1 = z0 + cellSize + 2 * maxRadius;
+        FrustumTest rowTest = testBounds(x0, z0, x1, z1);
+        if (rowTest == FRUSTUM_OUTSIDE) continue;
+        if (rowTest == FRUSTUM_INSIDE)
+        {
+            visit(cellStart[row], cellStart[row + cellsX], true);
+            continue;
+        }
+
+        for (int cx = 0; cx < cellsX; cx++)
+        {
+            int begin = cellStart[row + cx], end = cellStart[row + cx + 1];
+            if (begin == end) continue;
+
+            float cellX0 = minX + cx * cellSize - maxRadius;
+            FrustumTest cellTest = testBounds(cellX0, z0, cellX0 + cellSize + 2 * maxRadius, z1);
+            if (cellTest != FRUSTUM_OUTSIDE) visit(begin, end, cellTest == FRUSTUM_INSIDE);
+        }
+    }
+}
+
+inline bool AsteroidGrid::cellRange(float x, float z, float r,
+                                    int &x0, int &x1, int &z0, int &z1) const
+{
+    if (cellsX == 0) return false;
+
+    float reach = r + maxRadius;
+    x0 = (int)floorf((x - reach - minX) * invCellSize);
+    x1 = (int)floorf((x + reach - minX) * invCellSize);
+    z0 = (int)floorf((z - reach - minZ) * invCellSize);
+    z1 = (int)floorf((z + reach - minZ) * invCellSize);
+
+    // Probe lies entirely outside the grid.
+    if (x1 < 0 || z1 < 0 || x0 >= cellsX || z0 >= cellsZ) return false;
+
+    if (x0 < 0) x0 = 0;
+    if (z0 < 0) z0 = 0;
+    if (x1 >= cellsX) x1 = cellsX - 1;
+    if (z1 >= cellsZ) z1 = cellsZ - 1;
+    return true;
+}
+
+#endif
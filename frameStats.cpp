@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Frame statistics. See frameStats.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <iomanip>
+
+#include "frameStats.h"
+
+static const char *phaseNames[PHASE_COUNT] = { "viewport", "track", "asteroids", "car", "text", "swap" };
+
+// Microseconds between two time points.
+static float microseconds(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration<float, std::micro>(to - from).count();
+}
+
+// FrameStats default constructor.
+FrameStats::FrameStats()
+{
+    frameNumber = 0;
+    currentPhase = -1;
+}
+
+// Function to start the per-frame CSV file.
+bool FrameStats::openCsv(const char *path)
+{
+    csv.open(path);
+    if (!csv) return false;
+
+    csv << "frame,interval_us,total_us";
+    for (int p = 0; p < PHASE_COUNT; p++) csv << "," << phaseNames[p] << "_us";
+    csv << "\n";
+    return true;
+}
+
+// Function to start timing a frame.
+void FrameStats::beginFrame()
+{
+    frameStart = std::chrono::steady_clock::now();
+    current.interval = frameNumber > 0 ? microseconds(previousFrameStart, frameStart) : 0.0f;
+    for (int p = 0; p < PHASE_COUNT; p++) current.phases[p] = 0.0f;
+    currentPhase = -1;
+    previousFrameStart = frameStart;
+}
+
+void FrameStats::endPhase(std::chrono::steady_clock::time_point now)
+{
+    if (currentPhase >= 0) current.phases[currentPhase] += microseconds(phaseStart, now);
+}
+
+// Function to switch to timing another phase.
+void FrameStats::beginPhase(FramePhase phase)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    endPhase(now);
+    currentPhase = phase;
+    phaseStart = now;
+}
+
+// Function to finish the frame and store its record.
+void FrameStats::endFrame()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    endPhase(now);
+    currentPhase = -1;
+    current.total = microseconds(frameStart, now);
+    frames[frameNumber % FRAME_WINDOW] = current;
+
+    if (csv.is_open())
+    {
+        csv << frameNumber << "," << current.interval << "," << current.total;
+        for (int p = 0; p < PHASE_COUNT; p++) csv << "," << current.phases[p];
+        csv << "\n";
+    }
+    frameNumber++;
+}
+
+// Function to print the percentiles over the window.
+void FrameStats::report(std::ostream &out) const
+{
+    int count = frameNumber < FRAME_WINDOW ? (int)frameNumber : FRAME_WINDOW;
+    float values[FRAME_WINDOW];
+
+    if (count == 0) return;
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    // Print one row of percentiles of the value picked from each record.
+    auto row = [&](const char *name, float (*pick)(const FrameRecord &, int), int phase)
+    {
+        for (int k = 0; k < count; k++) values[k] = pick(frames[k], phase);
+        std::sort(values, values + count);
+        out << "  " << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(3)
+            << " p50 " << std::setw(8) << values[count / 2] / 1000.0
+            << " p95 " << std::setw(8) << values[count * 95 / 100] / 1000.0
+            << " p99 " << std::setw(8) << values[count * 99 / 100] / 1000.0
+            << " max " << std::setw(8) << values[count - 1] / 1000.0 << " ms" << std::endl;
+    };
+
+    out << "Last " << count << " frames:" << std::endl;
+    row("interval", [](const FrameRecord &r, int) { return r.interval; }, 0);
+    row("total", [](const FrameRecord &r, int) { return r.total; }, 0);
+    for (int p = 0; p < PHASE_COUNT; p++)
+    {
+        // Leave out phases the program does not time.
+        bool timed = false;
+        for (int k = 0; k < count && !timed; k++) timed = frames[k].phases[p] > 0.0f;
+        if (timed) row(phaseNames[p], [](const FrameRecord &r, int phase) { return r.phases[phase]; }, p);
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Frame statistics: CPU time of every frame split into drawing phases.
+//
+// Call beginFrame() at the top of the drawing routine, beginPhase() before each part
+// of it and endFrame() after the buffer swap. The last FRAME_WINDOW frames are kept
+// for rolling p50/p95/p99/max figures, and every frame can also be written to a CSV
+// file for offline analysis. A single slow frame shows up in the max and high
+// percentiles where a once-per-second FPS count averages it away.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <chrono>
+#include <fstream>
+#include <ostream>
+
+#define FRAME_WINDOW 1024 // Number of recent frames the percentiles are taken over.
+
+// Parts of a frame timed separately.
+enum FramePhase
+{
+    PHASE_VIEWPORT, // Viewport, camera and separator setup.
+    PHASE_TRACK,
+    PHASE_ASTEROIDS,
+    PHASE_CAR,
+    PHASE_TEXT,
+    PHASE_SWAP,
+    PHASE_COUNT
+};
+
+class FrameStats
+{
+public:
+    FrameStats();
+
+    // Write one line per frame to path from now on. Returns false if it cannot be opened.
+    bool openCsv(const char *path);
+
+    void beginFrame();
+
+    // End the current phase, if any, and start timing phase. A phase may be entered
+    // several times per frame; its times add up.
+    void beginPhase(FramePhase phase);
+
+    void endFrame();
+
+    // Print p50/p95/p99/max of the frame interval, frame time and each phase over the
+    // window, in milliseconds.
+    void report(std::ostream &out) const;
+
+private:
+    // Times of one frame, in microseconds.
+    struct FrameRecord
+    {
+        float interval; // Since the start of the previous frame.
+        float total; // From beginFrame() to endFrame().
+        float phases[PHASE_COUNT];
+    };
+
+    // Close the running phase at now.
+    void endPhase(std::chrono::steady_clock::time_point now);
+
+    FrameRecord frames[FRAME_WINDOW]; // Ring of recent frames.
+    FrameRecord current;
+    long long frameNumber; // Frames ended so far.
+    int currentPhase; // Phase being timed, -1 if none.
+    std::chrono::steady_clock::time_point frameStart, phaseStart, previousFrameStart;
+    std::ofstream csv;
+};
+
+#endif
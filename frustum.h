@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////////
+// View frustum for CPU-side culling.
+//
+// The six planes are extracted from a combined projection * view matrix (column-major,
+// as OpenGL and glm store it), so culling uses exactly the volume the camera renders.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <cmath>
+
+// Result of testing a volume against the frustum.
+enum FrustumTest
+{
+    FRUSTUM_OUTSIDE,
+    FRUSTUM_INTERSECTS,
+    FRUSTUM_INSIDE
+};
+
+class Frustum
+{
+public:
+    // Extract the planes of the clip matrix m = projection * view.
+    void extract(const float *m)
+    {
+        for (int i = 0; i < 3; i++)
+            for (int c = 0; c < 4; c++)
+            {
+                // Row 3 of the matrix plus or minus row i, i.e. left/right, bottom/top, near/far.
+                plane[2 * i][c] = m[4 * c + 3] + m[4 * c + i];
+                plane[2 * i + 1][c] = m[4 * c + 3] - m[4 * c + i];
+            }
+
+        // Normalize so plane distances are in world units.
+        for (int p = 0; p < 6; p++)
+        {
+            float length = sqrtf(plane[p][0] * plane[p][0] + plane[p][1] * plane[p][1] +
+                                 plane[p][2] * plane[p][2]);
+            for (int c = 0; c < 4; c++) plane[p][c] /= length;
+        }
+    }
+
+    // Is any part of the sphere at (x,y,z) with radius r inside the frustum?
+    bool sphereVisible(float x, float y, float z, float r) const
+    {
+        for (int p = 0; p < 6; p++)
+            if (plane[p][0] * x + plane[p][1] * y + plane[p][2] * z + plane[p][3] < -r) return false;
+        return true;
+    }
+
+    // Classify the axis-aligned box from (x0,y0,z0) to (x1,y1,z1).
+    FrustumTest testBox(float x0, float y0, float z0, float x1, float y1, float z1) const
+    {
+        FrustumTest result = FRUSTUM_INSIDE;
+        for (int p = 0; p < 6; p++)
+        {
+            // Distances of the corners furthest along and against the plane normal.
+            float a = plane[p][0], b = plane[p][1], c = plane[p][2], d = plane[p][3];
+            float most = a * (a > 0 ? x1 : x0) + b * (b > 0 ? y1 : y0) + c * (c > 0 ? z1 : z0) + d;
+            float least = a * (a > 0 ? x0 : x1) + b * (b > 0 ? y0 : y1) + c * (c > 0 ? z0 : z1) + d;
+            if (most < 0) return FRUSTUM_OUTSIDE;
+            if (least < 0) result = FRUSTUM_INTERSECTS;
+        }
+        return result;
+    }
+
+private:
+    float plane[6][4]; // a, b, c, d of ax + by + cz + d >= 0 for points inside.
+};
+
+#endif
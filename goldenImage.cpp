@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Golden image checks. See goldenImage.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#ifdef _WIN32
+#include <direct.h>
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <GL/gl.h>
+
+#include "goldenImage.h"
+
+// Function to write rgb pixels, bottom row first as glReadPixels returns them, as a
+// binary PPM image.
+static bool writePpm(const std::string &path, const std::vector<unsigned char> &rgb, int width, int height)
+{
+    std::ofstream file(path.c_str(), std::ios::binary);
+
+    file << "P6\n" << width << " " << height << "\n255\n";
+    for (int y = height - 1; y >= 0; y--) file.write((const char *)&rgb[3 * width * y], 3 * width);
+    return (bool)file;
+}
+
+// Function to read a binary PPM image written by writePpm() into rgb, bottom row first.
+static bool readPpm(const std::string &path, std::vector<unsigned char> &rgb, int &width, int &height)
+{
+    std::ifstream file(path.c_str(), std::ios::binary);
+    std::string magic;
+    int maxValue;
+
+    if (!(file >> magic >> width >> height >> maxValue) || magic != "P6" || maxValue != 255) return false;
+    file.get(); // The single whitespace before the pixels.
+    rgb.resize(3 * width * height);
+    for (int y = height - 1; y >= 0; y--) file.read((char *)&rgb[3 * width * y], 3 * width);
+    return (bool)file;
+}
+
+// Function to compute the difference hash of an image: its luminance averaged over a
+// 9 x 8 grid, one bit per pair of horizontal neighbours set if the left one is brighter.
+// Images that look alike have hashes differing in few bits.
+static uint64_t differenceHash(const std::vector<unsigned char> &rgb, int width, int height)
+{
+    double cells[8][9] = {};
+    int counts[8][9] = {};
+    uint64_t hash = 0;
+
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+        {
+            const unsigned char *p = &rgb[3 * (width * y + x)];
+            int row = 8 * y / height, column = 9 * x / width;
+            cells[row][column] += 0.299 * p[0] + 0.587 * p[1] + 0.114 * p[2];
+            counts[row][column]++;
+        }
+    for (int row = 0; row < 8; row++)
+        for (int column = 0; column < 8; column++)
+        {
+            double left = cells[row][column] / (counts[row][column] ? counts[row][column] : 1);
+            double right = cells[row][column + 1] / (counts[row][column + 1] ? counts[row][column + 1] : 1);
+            hash = (hash << 1) | (left > right ? 1 : 0);
+        }
+    return hash;
+}
+
+// Function to count the bits in which two hashes differ.
+static int hashDistance(uint64_t a, uint64_t b)
+{
+    int distance = 0;
+
+    for (uint64_t bits = a ^ b; bits; bits &= bits - 1) distance++;
+    return distance;
+}
+
+// GoldenCheck constructor. In update mode, creates dir if it does not exist yet;
+// otherwise loads the golden timings if any.
+GoldenCheck::GoldenCheck(const char *dir, const char *name, bool update)
+    : dir(dir), name(name), update(update), failures(0)
+{
+    if (update)
+    {
+#ifdef _WIN32
+        int made = _mkdir(dir);
+#else
+        int made = mkdir(dir, 0777);
+#endif
+        if (made != 0 && errno != EEXIST)
+            std::cout << "Cannot create the golden image directory " << dir << std::endl;
+        return;
+    }
+
+    std::ifstream timings((this->dir + "/" + this->name + "_timings.csv").c_str());
+    std::string line;
+    std::getline(timings, line); // Header.
+    while (std::getline(timings, line))
+    {
+        goldenFrames.push_back(atoi(line.c_str()));
+        goldenTimes.push_back(atof(line.substr(line.find(',') + 1).c_str()));
+    }
+}
+
+// Function to get the path of the image of frame, with suffix before the extension.
+std::string GoldenCheck::imagePath(int frame, const char *suffix) const
+{
+    return dir + "/" + name + "_frame" + std::to_string(frame) + suffix + ".ppm";
+}
+
+// Function to check one frame against its golden image.
+void GoldenCheck::check(int frame, int width, int height, double frameTime)
+{
+    std::vector<unsigned char> pixels(3 * width * height), golden;
+    int goldenWidth, goldenHeight;
+    std::ios::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
+    checkedFrames.push_back(frame);
+    checkedTimes.push_back(frameTime);
+
+    std::cout << name << " frame " << frame << ": " << std::fixed << std::setprecision(3) << frameTime << " ms";
+    for (size_t k = 0; k < goldenFrames.size(); k++)
+        if (goldenFrames[k] == frame && goldenTimes[k] > 0.0)
+            std::cout << " (golden " << goldenTimes[k] << " ms, " << std::showpos << std::setprecision(1)
+                      << 100.0 * (frameTime / goldenTimes[k] - 1.0) << "%" << std::noshowpos
+                      << std::setprecision(3) << ")";
+    std::cout << ", ";
+
+    if (update)
+    {
+        bool written = writePpm(imagePath(frame, ""), pixels, width, height);
+        std::cout << (written ? "golden image written" : "cannot write the golden image: FAILED") << std::endl;
+        if (!written) failures++;
+    }
+    else if (!readPpm(imagePath(frame, ""), golden, goldenWidth, goldenHeight) ||
+             goldenWidth != width || goldenHeight != height)
+    {
+        std::cout << "no golden image of this size: FAILED" << std::endl;
+        writePpm(imagePath(frame, ".actual"), pixels, width, height);
+        failures++;
+    }
+    else
+    {
+        // Pixels with any channel off by more than the tolerance.
+        int differing = 0;
+        for (int k = 0; k < width * height; k++)
+            for (int c = 0; c < 3; c++)
+                if (abs(pixels[3 * k + c] - golden[3 * k + c]) > GOLDEN_TOLERANCE)
+                {
+                    differing++;
+                    break;
+                }
+
+        bool match = differing <= GOLDEN_MAX_DIFFERING * width * height;
+        std::cout << differing << " pixels differ (" << std::setprecision(3)
+                  << 100.0 * differing / (width * height) << "%), dHash distance "
+                  << hashDistance(differenceHash(pixels, width, height), differenceHash(golden, width, height))
+                  << ": " << (match ? "ok" : "FAILED") << std::endl;
+        if (!match)
+        {
+            writePpm(imagePath(frame, ".actual"), pixels, width, height);
+            failures++;
+        }
+    }
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+// Function to write the timings in update mode and print the summary.
+int GoldenCheck::finish()
+{
+    if (update)
+    {
+        std::ofstream timings((dir + "/" + name + "_timings.csv").c_str());
+        timings << "frame,frame_ms\n";
+        for (size_t k = 0; k < checkedFrames.size(); k++) timings << checkedFrames[k] << "," << checkedTimes[k] << "\n";
+        std::cout << "Wrote " << checkedFrames.size() - failures << " of " << checkedFrames.size()
+                  << " golden images of " << name << " to " << dir << std::endl;
+        if (!timings)
+        {
+            std::cout << "Cannot write the golden timings of " << name << " to " << dir << std::endl;
+            failures++;
+        }
+    }
+    else
+        std::cout << checkedFrames.size() - failures << " of " << checkedFrames.size() << " frames of " << name
+                  << " match the golden images in " << dir << std::endl;
+    return failures;
+}
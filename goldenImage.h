@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Golden image checks for the offscreen benchmark (see offscreenContext.h).
+//
+// At chosen frames of a scripted offscreen run the framebuffer is read back and
+// compared with a stored golden image, dir/name_frameN.ppm. A frame passes if no more
+// than GOLDEN_MAX_DIFFERING of its pixels differ by more than GOLDEN_TOLERANCE in any
+// channel; a 64-bit difference hash (dHash) distance is printed as well, as a rough
+// measure of how different a failing frame looks. Failing frames are written next to
+// the golden as name_frameN.actual.ppm for inspection.
+//
+// The mean time of the frames drawn since the previous check is printed next to each
+// comparison, with the time recorded when the golden images were written
+// (dir/name_timings.csv), so a change to the drawing code shows both whether it still
+// draws the same and whether it got faster. In update mode the images and timings are
+// written instead of compared, creating dir if needed; any that cannot be written
+// count as failures.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GOLDEN_IMAGE_H
+#define GOLDEN_IMAGE_H
+
+#include <string>
+#include <vector>
+
+#define GOLDEN_TOLERANCE 16 // Largest channel difference still counted as the same.
+#define GOLDEN_MAX_DIFFERING 0.001 // Fraction of pixels allowed to differ.
+
+class GoldenCheck
+{
+public:
+    // Checks against the images dir/name_frameN.ppm, or writes them if update is set.
+    GoldenCheck(const char *dir, const char *name, bool update);
+
+    // Function to compare the current framebuffer, width x height pixels, with the
+    // golden image of frame, and print the result with frameTime, the mean time in
+    // milliseconds of the frames drawn since the previous check.
+    void check(int frame, int width, int height, double frameTime);
+
+    // Function to finish the run: writes the timings in update mode and prints a
+    // summary. Returns the number of frames that did not match or could not be written,
+    // plus one if the timings could not be written.
+    int finish();
+
+private:
+    std::string imagePath(int frame, const char *suffix) const;
+
+    std::string dir, name;
+    bool update;
+    std::vector<int> checkedFrames; // Frames checked so far, with their times.
+    std::vector<double> checkedTimes;
+    std::vector<int> goldenFrames; // Times recorded with the golden images.
+    std::vector<double> goldenTimes;
+    int failures;
+};
+
+#endif
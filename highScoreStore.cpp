@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////
+// High score table. See highScoreStore.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "highScoreStore.h"
+
+#define HIGH_SCORE_VERSION 1 // Version of the file format.
+
+static const unsigned char magic[4] = { 'S', 'S', 'H', 'S' };
+
+// Function to compute the CRC-32 (IEEE, as in zip and PNG) of size bytes.
+static uint32_t crc32(const unsigned char *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t k = 0; k < size; k++)
+    {
+        crc ^= data[k];
+        for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return ~crc;
+}
+
+// Function to append a 32-bit value, little endian.
+static void putUint32(std::vector<unsigned char> &bytes, uint32_t value)
+{
+    for (int k = 0; k < 4; k++) bytes.push_back((unsigned char)(value >> (8 * k)));
+}
+
+// Function to read the 32-bit little endian value at data.
+static uint32_t getUint32(const unsigned char *data)
+{
+    return data[0] | (uint32_t)data[1] << 8 | (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+// HighScoreStore constructor.
+HighScoreStore::HighScoreStore(const char *path) : path(path), dirty(false), stopping(false)
+{
+    if (!load()) loadLegacy();
+    writer = std::thread(&HighScoreStore::writerLoop, this);
+}
+
+// HighScoreStore destructor.
+HighScoreStore::~HighScoreStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_one();
+    writer.join();
+}
+
+// Function to load the table, returning false if there is none or it is damaged.
+bool HighScoreStore::load()
+{
+    std::vector<unsigned char> bytes;
+    unsigned char buffer[256];
+    size_t read;
+    FILE *file = fopen(path.c_str(), "rb");
+
+    if (file == NULL) return false;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) bytes.insert(bytes.end(), buffer, buffer + read);
+    fclose(file);
+
+    // Magic, version, count, the scores and the checksum.
+    uint32_t count = bytes.size() >= 12 ? getUint32(&bytes[8]) : 0;
+    if (bytes.size() < 16 || !std::equal(magic, magic + 4, bytes.begin()) ||
+        getUint32(&bytes[4]) != HIGH_SCORE_VERSION || count > HIGH_SCORE_ENTRIES ||
+        bytes.size() != 16 + 4 * count || getUint32(&bytes[12 + 4 * count]) != crc32(bytes.data(), 12 + 4 * count))
+    {
+        std::cout << "Ignoring the damaged high score table " << path << std::endl;
+        return false;
+    }
+
+    for (uint32_t k = 0; k < count; k++) scores.push_back((int32_t)getUint32(&bytes[12 + 4 * k]));
+    std::sort(scores.begin(), scores.end(), std::greater<int>());
+    return true;
+}
+
+// Function to take over the best score of the old text file, saving it in the new
+// table on the writer's first run.
+void HighScoreStore::loadLegacy()
+{
+    FILE *file = fopen(HIGH_SCORE_LEGACY_FILE, "r");
+    int best;
+
+    if (file == NULL) return;
+    if (fscanf(file, "%d", &best) == 1 && best > 0)
+    {
+        scores.push_back(best);
+        dirty = true;
+    }
+    fclose(file);
+}
+
+// Function to write table to a temporary file, flush it to disk and rename it over the
+// table. Returns false if the table could not be replaced, leaving the old one.
+bool HighScoreStore::save(const std::vector<int> &table)
+{
+    std::vector<unsigned char> bytes(magic, magic + 4);
+    std::string temporary = path + ".tmp";
+
+    putUint32(bytes, HIGH_SCORE_VERSION);
+    putUint32(bytes, (uint32_t)table.size());
+    for (size_t k = 0; k < table.size(); k++) putUint32(bytes, (uint32_t)table[k]);
+    putUint32(bytes, crc32(bytes.data(), bytes.size()));
+
+    FILE *file = fopen(temporary.c_str(), "wb");
+    if (file == NULL) return false;
+    bool written = fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() && fflush(file) == 0;
+#ifdef _WIN32
+    written = written && _commit(_fileno(file)) == 0;
+#else
+    written = written && fsync(fileno(file)) == 0;
+#endif
+    if (fclose(file) != 0 || !written)
+    {
+        remove(temporary.c_str());
+        return false;
+    }
+
+#ifdef _WIN32
+    return MoveFileExA(temporary.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    return rename(temporary.c_str(), path.c_str()) == 0;
+#endif
+}
+
+// Function run by the writer thread: saves the table each time it changes, writing
+// only the latest table if it changed several times during a save.
+void HighScoreStore::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (;;)
+    {
+        changed.wait(lock, [this] { return dirty || stopping; });
+        if (!dirty) return;
+
+        std::vector<int> table = scores;
+        dirty = false;
+        lock.unlock();
+        if (!save(table)) std::cout << "Cannot save the high score table " << path << std::endl;
+        lock.lock();
+    }
+}
+
+// Function to get the best score.
+int HighScoreStore::getBest()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return scores.empty() ? 0 : scores[0];
+}
+
+// Function to get a copy of the table.
+std::vector<int> HighScoreStore::getScores()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return scores;
+}
+
+// Function to enter a score in the table.
+bool HighScoreStore::submit(int score)
+{
+    bool best;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (scores.size() == HIGH_SCORE_ENTRIES && score <= scores.back()) return false;
+
+        best = scores.empty() || score > scores[0];
+        scores.insert(std::upper_bound(scores.begin(), scores.end(), score, std::greater<int>()), score);
+        if (scores.size() > HIGH_SCORE_ENTRIES) scores.pop_back();
+        dirty = true;
+    }
+    changed.notify_one();
+    return best;
+}
@@ -0,0 +1,62 @@
+///////////////////////////////////////////////////////////////////////////////////
+// High score table of the spaceship game, kept in memory and saved in the background.
+//
+// The best HIGH_SCORE_ENTRIES scores are loaded once when the store is created. After
+// that the game only reads and changes the table in memory: each change is saved by a
+// writer thread, so the game loop never waits on the disk. A save writes a temporary
+// file, flushes it to disk and renames it over the table, so a crash or power loss
+// leaves either the old table or the new one, never a torn one.
+//
+// File format, little endian: the magic "SSHS", a 32-bit version and entry count, the
+// scores as 32-bit integers from best down, then a CRC-32 of all of the above. A
+// table that fails the check is ignored. If there is no table yet, the best score of
+// the old text file (HIGH_SCORE_LEGACY_FILE) is taken over.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HIGH_SCORE_STORE_H
+#define HIGH_SCORE_STORE_H
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define HIGH_SCORE_ENTRIES 10 // Scores kept in the table.
+#define HIGH_SCORE_LEGACY_FILE "HighScoreFile.txt" // Text file of the best score, from older versions.
+
+class HighScoreStore
+{
+public:
+    // Loads the table from path and starts the writer thread.
+    HighScoreStore(const char *path);
+
+    // Saves any change not yet written and stops the writer thread.
+    ~HighScoreStore();
+
+    // Function to get the best score, 0 if there is none.
+    int getBest();
+
+    // Function to get a copy of the table, best first.
+    std::vector<int> getScores();
+
+    // Function to enter a score in the table if it is among the best, and have the
+    // table saved. Returns whether it is the new best score.
+    bool submit(int score);
+
+private:
+    bool load();
+    void loadLegacy();
+    bool save(const std::vector<int> &table);
+    void writerLoop();
+
+    std::string path;
+    std::vector<int> scores; // Best first.
+    std::mutex mutex; // Guards scores, dirty and stopping.
+    std::condition_variable changed;
+    bool dirty; // Has the table changed since the writer last saved it?
+    bool stopping;
+    std::thread writer;
+};
+
+#endif
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////////
+// OpenGL context with no window. See offscreenContext.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <iostream>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include "offscreenContext.h"
+
+static EGLDisplay display = EGL_NO_DISPLAY;
+static EGLContext context = EGL_NO_CONTEXT;
+static GLuint framebuffer, colorBuffer, depthBuffer;
+
+// Framebuffer object entry points, looked up once the context exists so this does not
+// need GLEW.
+static PFNGLGENFRAMEBUFFERSPROC genFramebuffers;
+static PFNGLBINDFRAMEBUFFERPROC bindFramebuffer;
+static PFNGLDELETEFRAMEBUFFERSPROC deleteFramebuffers;
+static PFNGLGENRENDERBUFFERSPROC genRenderbuffers;
+static PFNGLBINDRENDERBUFFERPROC bindRenderbuffer;
+static PFNGLDELETERENDERBUFFERSPROC deleteRenderbuffers;
+static PFNGLRENDERBUFFERSTORAGEPROC renderbufferStorage;
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC framebufferRenderbuffer;
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC checkFramebufferStatus;
+
+// Function to open the surfaceless EGL display, or the default one if the driver has
+// no surfaceless platform.
+static EGLDisplay openDisplay(void)
+{
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+        (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    const char *extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+
+    if (getPlatformDisplay && extensions && strstr(extensions, "EGL_MESA_platform_surfaceless"))
+        return getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+// Function to create the context, as a 4.3 compatibility profile like the GLUT window
+// asks for, falling back to whatever the driver offers.
+static EGLContext createContext(void)
+{
+    static const EGLint configAttributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    static const EGLint contextAttributes[] = { EGL_CONTEXT_MAJOR_VERSION, 4, EGL_CONTEXT_MINOR_VERSION, 3,
+                                                EGL_CONTEXT_OPENGL_PROFILE_MASK,
+                                                EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT, EGL_NONE };
+    EGLConfig config = (EGLConfig)0; // EGL_NO_CONFIG_KHR: nothing is drawn to an EGL surface.
+    EGLint configCount = 0;
+    EGLContext created;
+
+    eglChooseConfig(display, configAttributes, &config, 1, &configCount);
+    if (configCount == 0) config = (EGLConfig)0;
+
+    created = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (created == EGL_NO_CONTEXT) created = eglCreateContext(display, config, EGL_NO_CONTEXT, NULL);
+    return created;
+}
+
+// Function to create the context and its framebuffer.
+int createOffscreenContext(int width, int height)
+{
+    EGLint major, minor;
+
+    display = openDisplay();
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+    {
+        std::cerr << "Offscreen: cannot open an EGL display" << std::endl;
+        return 0;
+    }
+    if (!eglBindAPI(EGL_OPENGL_API) || (context = createContext()) == EGL_NO_CONTEXT)
+    {
+        std::cerr << "Offscreen: cannot create an OpenGL context" << std::endl;
+        eglTerminate(display);
+        return 0;
+    }
+    if (!eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+    {
+        std::cerr << "Offscreen: the EGL driver cannot make a context current without a surface" << std::endl;
+        destroyOffscreenContext();
+        return 0;
+    }
+
+    genFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)eglGetProcAddress("glGenFramebuffers");
+    bindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)eglGetProcAddress("glBindFramebuffer");
+    deleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)eglGetProcAddress("glDeleteFramebuffers");
+    genRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)eglGetProcAddress("glGenRenderbuffers");
+    bindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)eglGetProcAddress("glBindRenderbuffer");
+    deleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)eglGetProcAddress("glDeleteRenderbuffers");
+    renderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)eglGetProcAddress("glRenderbufferStorage");
+    framebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)eglGetProcAddress("glFramebufferRenderbuffer");
+    checkFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)eglGetProcAddress("glCheckFramebufferStatus");
+
+    // Color and depth renderbuffers, left bound for all drawing from now on.
+    genRenderbuffers(1, &colorBuffer);
+    bindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+    renderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    genRenderbuffers(1, &depthBuffer);
+    bindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+    renderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    bindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    genFramebuffers(1, &framebuffer);
+    bindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    framebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+    framebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depthBuffer);
+    if (checkFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        std::cerr << "Offscreen: incomplete framebuffer" << std::endl;
+        destroyOffscreenContext();
+        return 0;
+    }
+    glViewport(0, 0, width, height);
+
+    std::cout << "Offscreen: " << glGetString(GL_RENDERER) << ", OpenGL " << glGetString(GL_VERSION) << std::endl;
+    return 1;
+}
+
+// Function to release the framebuffer and the context.
+void destroyOffscreenContext(void)
+{
+    if (context != EGL_NO_CONTEXT && framebuffer)
+    {
+        bindFramebuffer(GL_FRAMEBUFFER, 0);
+        deleteFramebuffers(1, &framebuffer);
+        deleteRenderbuffers(1, &colorBuffer);
+        deleteRenderbuffers(1, &depthBuffer);
+        framebuffer = colorBuffer = depthBuffer = 0;
+    }
+    if (display != EGL_NO_DISPLAY)
+    {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (context != EGL_NO_CONTEXT) eglDestroyContext(display, context);
+        eglTerminate(display);
+    }
+    context = EGL_NO_CONTEXT;
+    display = EGL_NO_DISPLAY;
+}
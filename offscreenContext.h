@@ -0,0 +1,21 @@
+///////////////////////////////////////////////////////////////////////////////////
+// OpenGL context with no window, for benchmarking the drawing code on machines with
+// no window system or GPU.
+//
+// The context is created through EGL on its surfaceless platform (Mesa's llvmpipe
+// renders in software there), and everything is drawn into a framebuffer object of
+// the requested size. Built only when CMake finds EGL, which defines OFFSCREEN_RENDERING.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef OFFSCREEN_CONTEXT_H
+#define OFFSCREEN_CONTEXT_H
+
+// Function to create an OpenGL compatibility profile context, current on the calling
+// thread, drawing into a width x height RGBA framebuffer with a depth buffer.
+// Prints the reason and returns 0 on failure.
+int createOffscreenContext(int width, int height);
+
+// Function to release the framebuffer and the context.
+void destroyOffscreenContext(void);
+
+#endif
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Background grid for Poisson-disk placement. See poissonDisk.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include "poissonDisk.h"
+
+#define EMPTY_CELL 1.0e30f // Coordinate of an empty cell, too far away to conflict with anything.
+
+// PoissonDiskGrid default constructor.
+PoissonDiskGrid::PoissonDiskGrid()
+{
+    minX = 0.0;
+    minZ = 0.0;
+    invCellSize = 1.0;
+    minDistanceSquared = 0.0;
+    cellsX = 0;
+    cellsZ = 0;
+}
+
+// Function to empty and size the grid.
+void PoissonDiskGrid::reset(float x0, float z0, float x1, float z1, float minDistance)
+{
+    float cellSize = minDistance / sqrtf(2.0);
+
+    minX = x0;
+    minZ = z0;
+    invCellSize = 1.0 / cellSize;
+    minDistanceSquared = minDistance * minDistance;
+    cellsX = (int)((x1 - x0) * invCellSize) + 1;
+    cellsZ = (int)((z1 - z0) * invCellSize) + 1;
+    points.assign(2 * (size_t)cellsX * cellsZ, EMPTY_CELL);
+}
+
+int PoissonDiskGrid::cellOf(float x, float z) const
+{
+    int cx = (int)((x - minX) * invCellSize);
+    int cz = (int)((z - minZ) * invCellSize);
+    if (cx < 0) cx = 0;
+    if (cz < 0) cz = 0;
+    if (cx >= cellsX) cx = cellsX - 1;
+    if (cz >= cellsZ) cz = cellsZ - 1;
+    return cz * cellsX + cx;
+}
+
+// Function to compare a candidate with the points of the surrounding cells.
+bool PoissonDiskGrid::fits(float x, float z) const
+{
+    int cell = cellOf(x, z), cx = cell % cellsX, cz = cell / cellsX;
+    int x0 = cx > 2 ? cx - 2 : 0, x1 = cx + 2 < cellsX ? cx + 2 : cellsX - 1;
+    int z0 = cz > 2 ? cz - 2 : 0, z1 = cz + 2 < cellsZ ? cz + 2 : cellsZ - 1;
+
+    for (int j = z0; j <= z1; j++)
+        for (int i = x0; i <= x1; i++)
+        {
+            const float *point = &points[2 * ((size_t)j * cellsX + i)];
+            float dx = point[0] - x, dz = point[1] - z;
+            if (dx * dx + dz * dz < minDistanceSquared) return false;
+        }
+    return true;
+}
+
+// Function to store an accepted point in its cell.
+void PoissonDiskGrid::insert(float x, float z)
+{
+    size_t cell = cellOf(x, z);
+    points[2 * cell] = x;
+    points[2 * cell + 1] = z;
+}
@@ -0,0 +1,39 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Background grid for Poisson-disk (dart throwing) placement on the XZ plane.
+//
+// Cells are minDistance / sqrt(2) wide, so each holds at most one accepted point and
+// a candidate only has to be compared with the points of the 5x5 cells around it,
+// whatever the number of points already placed.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef POISSON_DISK_H
+#define POISSON_DISK_H
+
+#include <vector>
+
+class PoissonDiskGrid
+{
+public:
+    PoissonDiskGrid();
+
+    // Empty the grid and size it for points in [x0, x1] x [z0, z1] kept at least
+    // minDistance apart. Keeps the storage when the new grid is not larger.
+    void reset(float x0, float z0, float x1, float z1, float minDistance);
+
+    // Is (x, z) at least minDistance from every accepted point?
+    bool fits(float x, float z) const;
+
+    // Accept (x, z). The point must fit.
+    void insert(float x, float z);
+
+private:
+    // Cell holding (x, z), clamped to the grid.
+    int cellOf(float x, float z) const;
+
+    float minX, minZ;
+    float invCellSize, minDistanceSquared;
+    int cellsX, cellsZ;
+    std::vector<float> points; // x and z of the point of each cell, far away if empty.
+};
+
+#endif
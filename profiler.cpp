@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Scoped profiling zones with Chrome trace export. See profiler.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "profiler.h"
+
+#ifdef ENABLE_PROFILING
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+// One recorded zone.
+struct ProfileEvent
+{
+    const char *name;
+    int64_t start, duration; // Nanoseconds.
+};
+
+// Zones of one thread. Only its thread writes to it; it is read once, at exit.
+struct ProfileRing
+{
+    ProfileEvent events[PROFILE_RING_SIZE];
+    uint64_t count; // Zones recorded so far, including overwritten ones.
+    int threadId;
+    const char *threadName;
+};
+
+static std::mutex ringsMutex; // Guards rings while threads register.
+static std::vector<ProfileRing *> rings; // Every thread's ring; never freed, so exit can read them.
+static std::chrono::steady_clock::time_point profilerStart = std::chrono::steady_clock::now();
+static thread_local ProfileRing *threadRing = NULL;
+
+// Nanoseconds since the profiler started.
+static int64_t profilerNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - profilerStart).count();
+}
+
+// Function to write every ring to the trace file.
+static void writeTrace(void)
+{
+    const char *path = getenv("PROFILE_TRACE");
+    if (path == NULL) path = "trace.json";
+
+    FILE *file = fopen(path, "w");
+    if (file == NULL) return;
+
+    std::lock_guard<std::mutex> lock(ringsMutex);
+    const char *separator = "";
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (size_t r = 0; r < rings.size(); r++)
+    {
+        ProfileRing *ring = rings[r];
+        if (ring->threadName != NULL)
+        {
+            fprintf(file, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                    separator, ring->threadId, ring->threadName);
+            separator = ",";
+        }
+
+        // Oldest surviving zone first.
+        uint64_t first = ring->count > PROFILE_RING_SIZE ? ring->count - PROFILE_RING_SIZE : 0;
+        for (uint64_t k = first; k < ring->count; k++)
+        {
+            const ProfileEvent &event = ring->events[k % PROFILE_RING_SIZE];
+            fprintf(file, "%s\n{\"ph\":\"X\",\"name\":\"%s\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    separator, event.name, ring->threadId, event.start / 1000.0, event.duration / 1000.0);
+            separator = ",";
+        }
+    }
+    fprintf(file, "\n]}\n");
+    fclose(file);
+}
+
+// Function to get the calling thread's ring, creating it on first use.
+static ProfileRing *getThreadRing(void)
+{
+    if (threadRing == NULL)
+    {
+        ProfileRing *ring = new ProfileRing;
+        ring->count = 0;
+        ring->threadName = NULL;
+
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        if (rings.empty()) atexit(writeTrace);
+        ring->threadId = (int)rings.size() + 1;
+        rings.push_back(ring);
+        threadRing = ring;
+    }
+    return threadRing;
+}
+
+// ProfileZone constructor.
+ProfileZone::ProfileZone(const char *name)
+{
+    this->name = name;
+    start = profilerNow();
+}
+
+// ProfileZone destructor: records the zone.
+ProfileZone::~ProfileZone()
+{
+    int64_t end = profilerNow();
+    ProfileRing *ring = getThreadRing();
+    ProfileEvent &event = ring->events[ring->count % PROFILE_RING_SIZE];
+
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    ring->count++;
+}
+
+// Function to name the calling thread.
+void profilerNameThread(const char *name)
+{
+    getThreadRing()->threadName = name;
+}
+
+#endif
@@ -0,0 +1,52 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Scoped profiling zones with Chrome trace export.
+//
+// Put PROFILE_FUNCTION() or PROFILE_ZONE("name") at the top of a block to time it.
+// Each thread records its zones in its own ring buffer of the last PROFILE_RING_SIZE
+// zones, with no locking, and all buffers are written as a Chrome trace-event JSON
+// file when the program exits (open it in chrome://tracing or ui.perfetto.dev). The
+// file is trace.json unless the PROFILE_TRACE environment variable names another.
+//
+// Zones are only recorded when built with ENABLE_PROFILING (cmake -DENABLE_PROFILING=ON);
+// otherwise the macros expand to nothing and cost nothing.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#ifdef ENABLE_PROFILING
+
+#include <cstdint>
+
+#define PROFILE_RING_SIZE 65536 // Zones kept per thread; older ones are overwritten.
+
+// Times the scope it lives in. name must outlive the program, e.g. a string literal.
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char *name);
+    ~ProfileZone();
+
+private:
+    const char *name;
+    int64_t start; // Nanoseconds since the profiler started.
+};
+
+// Function to name the calling thread in the trace.
+void profilerNameThread(const char *name);
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+#define PROFILE_THREAD(name) profilerNameThread(name)
+
+#else
+
+#define PROFILE_ZONE(name)
+#define PROFILE_FUNCTION()
+#define PROFILE_THREAD(name)
+
+#endif
+
+#endif
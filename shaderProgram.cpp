@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Helper to compile and link GLSL programs. See shaderProgram.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <iostream>
+
+#include <glew.h>
+
+#include "shaderProgram.h"
+
+// Function to compile one shader stage, printing the log on failure.
+static GLuint compileShader(GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader(type);
+    GLint status;
+
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (!status)
+    {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        std::cerr << (type == GL_VERTEX_SHADER ? "Vertex" : "Fragment")
+                  << " shader error: " << log << std::endl;
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+// Function to compile both stages and link them.
+unsigned int buildShaderProgram(const char *vertexSource, const char *fragmentSource,
+                                const char *const *attributes)
+{
+    GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
+    GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER, fragmentSource);
+    GLuint program = 0;
+    GLint status;
+
+    if (vertexShader && fragmentShader)
+    {
+        program = glCreateProgram();
+        glAttachShader(program, vertexShader);
+        glAttachShader(program, fragmentShader);
+        for (GLuint k = 0; attributes && attributes[k]; k++)
+            glBindAttribLocation(program, k, attributes[k]);
+        glLinkProgram(program);
+        glGetProgramiv(program, GL_LINK_STATUS, &status);
+        if (!status)
+        {
+            char log[1024];
+            glGetProgramInfoLog(program, sizeof(log), NULL, log);
+            std::cerr << "Shader link error: " << log << std::endl;
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    // The program keeps what it needs once linked.
+    if (vertexShader) glDeleteShader(vertexShader);
+    if (fragmentShader) glDeleteShader(fragmentShader);
+    return program;
+}
@@ -0,0 +1,16 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Helper to compile and link the small GLSL programs used for instanced drawing.
+// The programs target the compatibility profile so they can read the fixed-function
+// matrices (gl_ModelViewProjectionMatrix) set up with glFrustum/gluLookAt.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SHADER_PROGRAM_H
+#define SHADER_PROGRAM_H
+
+// Function to build a program from vertex and fragment shader sources. Vertex inputs
+// are bound to locations 0, 1, 2, ... in the order given in attributes, a NULL
+// terminated list. Compile and link errors are printed and 0 is returned.
+unsigned int buildShaderProgram(const char *vertexSource, const char *fragmentSource,
+                                const char *const *attributes);
+
+#endif
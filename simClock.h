@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Fixed-timestep simulation clock.
+//
+// Call advance() once per pass of the main loop to find how many fixed simulation
+// steps are due, run that many, then render with alpha() to interpolate between the
+// last two simulation states. The simulation rate then no longer depends on the frame
+// rate or on how often the OS repeats keys.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+#include <chrono>
+
+class SimClock
+{
+public:
+    // Clock running at stepsPerSecond; at most maxSteps are run per advance() so a long
+    // stall is dropped instead of replayed.
+    explicit SimClock(double stepsPerSecond, int maxSteps = 8)
+    {
+        step = 1.0 / stepsPerSecond;
+        accumulator = 0.0;
+        this->maxSteps = maxSteps;
+        last = std::chrono::steady_clock::now();
+    }
+
+    // Number of steps due since the previous call.
+    int advance()
+    {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        accumulator += std::chrono::duration<double>(now - last).count();
+        last = now;
+
+        int steps = (int)(accumulator / step);
+        accumulator -= steps * step;
+        if (steps > maxSteps) steps = maxSteps;
+        return steps;
+    }
+
+    // Fraction of a step elapsed since the last one, in [0, 1).
+    float alpha() const { return (float)(accumulator / step); }
+
+    // Length of one step in seconds.
+    double getStep() const { return step; }
+
+private:
+    std::chrono::steady_clock::time_point last;
+    double step, accumulator;
+    int maxSteps;
+};
+
+#endif
@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////////////////////////
+// GLUT-style solid shapes without GLUT. See solidShapes.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+
+#include "solidShapes.h"
+
+// Scratch geometry, reused by every call. Like GLUT, each call tessellates again.
+static std::vector<float> vertices, normals;
+static std::vector<unsigned int> indices;
+static ShapeMesh *targetMesh; // Mesh the triangles go to instead of being drawn, if set.
+static unsigned int targetBase; // Index in targetMesh of the first scratch vertex.
+
+// Function to fill sint and cost with the sines and cosines of n + 1 angles evenly
+// spaced around a full circle, or half of one, clockwise for negative n. The last
+// entry closes the circle.
+static void circleTable(std::vector<float> &sint, std::vector<float> &cost, int n, bool halfCircle)
+{
+    int size = abs(n);
+    float step = (halfCircle ? 1 : 2) * (float)M_PI / (float)(n == 0 ? 1 : n);
+
+    sint.resize(size + 1);
+    cost.resize(size + 1);
+    sint[0] = 0.0;
+    cost[0] = 1.0;
+    for (int i = 1; i < size; i++)
+    {
+        sint[i] = sinf(step * i);
+        cost[i] = cosf(step * i);
+    }
+    sint[size] = halfCircle ? 0.0f : sint[0];
+    cost[size] = halfCircle ? -1.0f : cost[0];
+}
+
+// Function to add a vertex and its normal to the scratch geometry.
+static void addVertex(float x, float y, float z, float nx, float ny, float nz)
+{
+    vertices.push_back(x);
+    vertices.push_back(y);
+    vertices.push_back(z);
+    normals.push_back(nx);
+    normals.push_back(ny);
+    normals.push_back(nz);
+}
+
+// Function to generate the sphere vertices: the top, slices vertices for each of the
+// stacks - 1 rings from top to bottom, then the bottom.
+static void generateSphere(float radius, int slices, int stacks)
+{
+    static std::vector<float> sint1, cost1, sint2, cost2;
+
+    circleTable(sint1, cost1, -slices, false);
+    circleTable(sint2, cost2, stacks, true);
+
+    vertices.clear();
+    normals.clear();
+    addVertex(0.0, 0.0, radius, 0.0, 0.0, 1.0);
+    for (int i = 1; i < stacks; i++)
+        for (int j = 0; j < slices; j++)
+        {
+            float x = cost1[j] * sint2[i], y = sint1[j] * sint2[i], z = cost2[i];
+            addVertex(x * radius, y * radius, z * radius, x, y, z);
+        }
+    addVertex(0.0, 0.0, -radius, 0.0, 0.0, -1.0);
+}
+
+// Function to add the triangles of a primitive of length indices, a triangle list, strip
+// or fan, to targetMesh, wound as GL would draw them. The triangles strips degenerate
+// into at the poles are left out.
+static void addTriangles(GLenum mode, const unsigned int *primitive, int length)
+{
+    for (int k = 2; k < length; k += mode == GL_TRIANGLES ? 3 : 1)
+    {
+        unsigned int a, b, c = primitive[k];
+        if (mode == GL_TRIANGLE_FAN) a = primitive[0], b = primitive[k - 1];
+        else if (mode == GL_TRIANGLES || k % 2 == 0) a = primitive[k - 2], b = primitive[k - 1];
+        else a = primitive[k - 1], b = primitive[k - 2];
+        if (a == b || b == c || c == a) continue;
+        targetMesh->indices.push_back(targetBase + a);
+        targetMesh->indices.push_back(targetBase + b);
+        targetMesh->indices.push_back(targetBase + c);
+    }
+}
+
+// Function to draw count primitives of length indices each from the scratch geometry,
+// or to add them to targetMesh if it is set.
+static void drawIndexed(GLenum mode, int count, int length)
+{
+    if (targetMesh)
+    {
+        for (int k = 0; k < count; k++) addTriangles(mode, indices.data() + k * length, length);
+        return;
+    }
+
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, vertices.data());
+    glNormalPointer(GL_FLOAT, 0, normals.data());
+    for (int k = 0; k < count; k++)
+        glDrawElements(mode, length, GL_UNSIGNED_INT, indices.data() + k * length);
+    glPopClientAttrib();
+}
+
+// Function to draw a solid sphere as one triangle strip per stack.
+void drawSolidSphere(double radius, int slices, int stacks)
+{
+    if (slices < 1 || stacks < 2) return;
+    generateSphere(radius, slices, stacks);
+    unsigned int bottom = (unsigned int)vertices.size() / 3 - 1;
+
+    indices.clear();
+    for (int i = 0; i < stacks; i++)
+    {
+        // Ring above and below this stack; the poles stand in for the missing rings.
+        unsigned int above = i == 0 ? 0 : 1 + (i - 1) * slices;
+        unsigned int below = 1 + i * slices;
+        for (int j = 0; j <= slices; j++)
+        {
+            int k = j % slices;
+            indices.push_back(i == stacks - 1 ? bottom : below + k);
+            indices.push_back(i == 0 ? 0 : above + k);
+        }
+    }
+    drawIndexed(GL_TRIANGLE_STRIP, stacks, 2 * (slices + 1));
+}
+
+// Function to draw a wire sphere: a line loop per ring and a line from pole to pole
+// per slice.
+void drawWireSphere(double radius, int slices, int stacks)
+{
+    if (slices < 1 || stacks < 2) return;
+    generateSphere(radius, slices, stacks);
+    unsigned int bottom = (unsigned int)vertices.size() / 3 - 1;
+
+    indices.clear();
+    for (int j = 0; j < slices; j++)
+    {
+        indices.push_back(0);
+        for (int i = 1; i < stacks; i++) indices.push_back(1 + (i - 1) * slices + j);
+        indices.push_back(bottom);
+    }
+    drawIndexed(GL_LINE_STRIP, slices, stacks + 1);
+
+    indices.clear();
+    for (int i = 1; i < stacks; i++)
+        for (int j = 0; j < slices; j++) indices.push_back(1 + (i - 1) * slices + j);
+    drawIndexed(GL_LINE_LOOP, stacks - 1, slices);
+}
+
+// Function to draw a solid cube as two triangles per face.
+void drawSolidCube(double size)
+{
+    static const float corners[8][3] = { { -0.5, -0.5, -0.5 }, { 0.5, -0.5, -0.5 }, { 0.5, 0.5, -0.5 },
+                                         { -0.5, 0.5, -0.5 }, { -0.5, -0.5, 0.5 }, { 0.5, -0.5, 0.5 },
+                                         { 0.5, 0.5, 0.5 }, { -0.5, 0.5, 0.5 } };
+    static const int faces[6][4] = { { 0, 3, 2, 1 }, { 4, 5, 6, 7 }, { 0, 1, 5, 4 },
+                                     { 3, 7, 6, 2 }, { 0, 4, 7, 3 }, { 1, 2, 6, 5 } };
+    static const float faceNormals[6][3] = { { 0, 0, -1 }, { 0, 0, 1 }, { 0, -1, 0 },
+                                             { 0, 1, 0 }, { -1, 0, 0 }, { 1, 0, 0 } };
+    static const int order[6] = { 0, 1, 2, 0, 2, 3 };
+
+    vertices.clear();
+    normals.clear();
+    indices.clear();
+    for (int f = 0; f < 6; f++)
+    {
+        for (int k = 0; k < 4; k++)
+        {
+            const float *corner = corners[faces[f][k]];
+            addVertex(corner[0] * size, corner[1] * size, corner[2] * size,
+                      faceNormals[f][0], faceNormals[f][1], faceNormals[f][2]);
+        }
+        for (int k = 0; k < 6; k++) indices.push_back(4 * f + order[k]);
+    }
+    drawIndexed(GL_TRIANGLES, 1, 36);
+}
+
+// Function to draw a solid cylinder: the base and top as triangle fans and the side as
+// one triangle strip per stack.
+void drawSolidCylinder(double radius, double height, int slices, int stacks)
+{
+    static std::vector<float> sint, cost;
+
+    if (slices < 1 || stacks < 1) return;
+    circleTable(sint, cost, -slices, false);
+
+    vertices.clear();
+    normals.clear();
+
+    // Base, side rings from bottom to top, then the top; caps and side get their own
+    // vertices so each has its own normals.
+    addVertex(0.0, 0.0, 0.0, 0.0, 0.0, -1.0);
+    for (int j = 0; j < slices; j++) addVertex(cost[j] * radius, sint[j] * radius, 0.0, 0.0, 0.0, -1.0);
+    for (int i = 0; i <= stacks; i++)
+        for (int j = 0; j < slices; j++)
+            addVertex(cost[j] * radius, sint[j] * radius, height * i / stacks, cost[j], sint[j], 0.0);
+    for (int j = 0; j < slices; j++) addVertex(cost[j] * radius, sint[j] * radius, height, 0.0, 0.0, 1.0);
+    addVertex(0.0, 0.0, height, 0.0, 0.0, 1.0);
+    unsigned int side = 1 + slices, top = side + (stacks + 1) * slices;
+
+    // Base, walking the ring backwards so it faces down.
+    indices.clear();
+    indices.push_back(0);
+    for (int j = slices; j >= 0; j--) indices.push_back(1 + j % slices);
+    drawIndexed(GL_TRIANGLE_FAN, 1, slices + 2);
+
+    indices.clear();
+    for (int i = 0; i < stacks; i++)
+        for (int j = 0; j <= slices; j++)
+        {
+            indices.push_back(side + i * slices + j % slices);
+            indices.push_back(side + (i + 1) * slices + j % slices);
+        }
+    drawIndexed(GL_TRIANGLE_STRIP, stacks, 2 * (slices + 1));
+
+    indices.clear();
+    indices.push_back(top + slices);
+    for (int j = 0; j <= slices; j++) indices.push_back(top + j % slices);
+    drawIndexed(GL_TRIANGLE_FAN, 1, slices + 2);
+}
+
+// Function to add the scratch geometry of the shape just drawn into targetMesh to it.
+static void finishMesh(void)
+{
+    targetMesh->vertices.insert(targetMesh->vertices.end(), vertices.begin(), vertices.end());
+    targetMesh->normals.insert(targetMesh->normals.end(), normals.begin(), normals.end());
+    targetMesh = NULL;
+}
+
+// Function to point the shape functions at mesh instead of GL.
+static void startMesh(ShapeMesh &mesh)
+{
+    targetMesh = &mesh;
+    targetBase = (unsigned int)mesh.vertices.size() / 3;
+    vertices.clear(); // Nothing to add if the shape turns out empty.
+    normals.clear();
+}
+
+// Function to add the triangles of drawSolidSphere() to mesh.
+void generateSolidSphere(double radius, int slices, int stacks, ShapeMesh &mesh)
+{
+    startMesh(mesh);
+    drawSolidSphere(radius, slices, stacks);
+    finishMesh();
+}
+
+// Function to add the triangles of drawSolidCube() to mesh.
+void generateSolidCube(double size, ShapeMesh &mesh)
+{
+    startMesh(mesh);
+    drawSolidCube(size);
+    finishMesh();
+}
+
+// Function to add the triangles of drawSolidCylinder() to mesh.
+void generateSolidCylinder(double radius, double height, int slices, int stacks, ShapeMesh &mesh)
+{
+    startMesh(mesh);
+    drawSolidCylinder(radius, height, slices, stacks);
+    finishMesh();
+}
@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Drop-in versions of glutSolidSphere, glutWireSphere, glutSolidCube and
+// glutSolidCylinder.
+//
+// They tessellate like freeglut and draw from vertex arrays the same way, but need no
+// glutInit, so the games can draw into a context that GLUT did not create (see
+// offscreenContext.h). Unlike freeglut they use 32-bit indices, so very finely
+// tessellated spheres do not wrap around at 65536 vertices.
+//
+// The generate functions add the same triangles to a mesh instead of drawing them, so
+// that shapes can be baked into vertex buffers.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SOLID_SHAPES_H
+#define SOLID_SHAPES_H
+
+#include <vector>
+
+// Indexed triangle list: three coordinates per vertex and normal, three indices per
+// triangle.
+struct ShapeMesh
+{
+    std::vector<float> vertices, normals;
+    std::vector<unsigned int> indices;
+};
+
+// Function to draw a sphere centered at the origin, cut into slices around the z axis
+// and stacks along it.
+void drawSolidSphere(double radius, int slices, int stacks);
+
+// Function to draw the slice and stack lines of the same sphere.
+void drawWireSphere(double radius, int slices, int stacks);
+
+// Function to draw a cube of side size centered at the origin.
+void drawSolidCube(double size);
+
+// Function to draw a closed cylinder around the z axis from z = 0 to z = height.
+void drawSolidCylinder(double radius, double height, int slices, int stacks);
+
+// Functions to add the triangles of the solid shapes above to mesh.
+void generateSolidSphere(double radius, int slices, int stacks, ShapeMesh &mesh);
+void generateSolidCube(double size, ShapeMesh &mesh);
+void generateSolidCylinder(double radius, double height, int slices, int stacks, ShapeMesh &mesh);
+
+#endif
@@ -12,6 +12,9 @@
 // Interaction:
 // Press the left/right arrow keys to turn the craft.
 // Press the up/down arrow keys to move the craft.
+// Start with --endless for a track that is generated ahead of the car with no finish line.
+// Start with --offscreen N to draw N frames with no window (EGL) and print the frame times;
+// add --golden DIR or --update-golden DIR to check or record golden images of them.
 //
 // cr. code: Sumanta Guha.
 ///////////////////////////////////////////////////////////////////////////////////
@@ -23,110 +26,105 @@
 
 #define _USE_MATH_DEFINES
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <glew.h>
 #include <freeglut.h> 
-
-#define ROWS 10  // Number of rows of asteroids.
-#define COLUMNS 5 // Number of columns of asteroids.
-#define FILL_PROBABILITY 50 // Percentage probability that a particular row-column slot will be
-                             // filled with an asteroid. It should be an integer between 0 and 100.
-
-#define SIZE 10 // Size of each obstacle.
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "frameStats.h"
+#include "frustum.h"
+#include "profiler.h"
+#include "shaderProgram.h"
+#include "simClock.h"
+#include "solidShapes.h"
+#include "spaceTravelSim.h"
+#include "textRenderer.h"
+#include "tripleBuffer.h"
+
+#ifdef OFFSCREEN_RENDERING
+#include "goldenImage.h"
+#include "offscreenContext.h"
+#endif
+
+#define SIM_RATE 30 // Simulation steps per second, independent of the frame rate.
+#define STATS_REPORT_SECONDS 5 // Seconds between frame time reports.
+#define RESTART_DELAY 3 // Seconds a crash or finish stays on screen before the restart.
+#define OFFSCREEN_WIDTH 800 // Size of the offscreen framebuffer, the same as the window.
+#define OFFSCREEN_HEIGHT 400
+#define GOLDEN_CHECKS 4 // Evenly spaced frames of an offscreen run checked against golden images.
 
 // Globals.
-static long font = (long)GLUT_BITMAP_TIMES_ROMAN_24; // Larger font selection.
 static int width, height; // Size of the OpenGL window.
-static float angle = 0.0; // Angle of the car.
-static float xVal = 0, zVal = 120; // Co-ordinates of the car.
-static int isCollision = 0; // Is there collision between the car and an asteroid?
-static unsigned int car; // Display lists base index.
 static int frameCount = 0; // Number of frames
-
-// Routine to draw a bitmap character string.
-void writeBitmapString(void *font, char *string)
-{
-	char *c;
-
-	for (c = string; *c != '\0'; c++) glutBitmapCharacter(font, *c);
-}
-
-// Asteroid class.
-class Asteroid
+static int offscreen = 0; // Drawing into an offscreen framebuffer, with no GLUT window (--offscreen).
+static FrameStats frameStats; // Per-frame and per-phase timings.
+static SimClock simClock(SIM_RATE); // Paces the fixed simulation steps.
+static float prevXVal = 0, prevZVal = 120, prevAngle = 0.0; // Car before the last simulation step.
+static std::atomic<int> keyDown[4]; // Arrow keys held down, indexed by CarInput.
+static std::atomic<int> keyPressed[4]; // Arrow keys pressed since the last simulation step.
+static int restartPending = 0; // Is a restart scheduled?
+static int restartSteps; // Simulation steps left before the scheduled restart.
+
+// State of the game the simulation thread publishes for drawing.
+struct GameSnapshot
 {
-public:
-	Asteroid();
-	Asteroid(float x, float y, float z, float r, unsigned char colorR,
-		unsigned char colorG, unsigned char colorB);
-	float getCenterX() { return centerX; }
-	float getCenterY() { return centerY; }
-	float getCenterZ() { return centerZ; }
-	float getRadius() { return radius; }
-	void draw();
-
-private:
-	float centerX, centerY, centerZ, radius;
-	unsigned char color[3];
+    float prevX, prevZ, prevAngle; // Car before the last simulation step.
+    float x, z, angle; // Car after it.
+    int isCollision; // Has the car hit an asteroid or the track edge?
+    int finished; // Has the car crossed the finish line?
+    std::chrono::steady_clock::time_point stepTime; // When the last step was due.
 };
 
-// Asteroid default constructor.
-Asteroid::Asteroid()
-{
-	centerX = 0.0;
-	centerY = 0.0;
-	centerZ = 0.0;
-	radius = 0.0; // Indicates no asteroid exists in the position.
-	color[0] = 0;
-	color[1] = 0;
-	color[2] = 0;
-}
-
-// Asteroid constructor.
-Asteroid::Asteroid(float x, float y, float z, float r, unsigned char colorR,
-	unsigned char colorG, unsigned char colorB)
-{
-	centerX = x;
-	centerY = y;
-	centerZ = z;
-	radius = r;
-	color[0] = colorR;
-	color[1] = colorG;
-	color[2] = colorB;
-}
-
-// Function to draw asteroid.
-void Asteroid::draw()
-{
-	if (radius > 0.0) // If asteroid exists.
-	{
-		glPushMatrix();
-		glTranslatef(centerX, centerY, centerZ);
-		glColor3ubv(color);
-        glutSolidCube(radius);
-		glPopMatrix();
-	}
-}
-
-Asteroid arrayAsteroids[ROWS][COLUMNS]; // Global array of asteroids.
-
-// Routine to count the number of frames drawn every second.
+static TripleBuffer<GameSnapshot> snapshots; // From the simulation thread to drawScene().
+static std::mutex fieldMutex; // Held while the simulation rewrites the asteroid field or drawing reads it.
+static std::thread simThread; // Runs simulationLoop().
+static std::atomic<int> simRunning(0); // Cleared to stop the simulation thread.
+static std::atomic<long long> restartMicroseconds(-1); // Time of the last restart not yet reported, -1 if none.
+static unsigned int carVao, carVbo, carIbo; // Baked car model.
+static int carIndexCount; // Number of indices in carIbo.
+static unsigned int trackVao, trackVbo; // Baked track geometry.
+static int trackVertexCount; // Number of vertices in trackVbo.
+static unsigned int trackStreamVao, trackStreamVbo; // Ring of track segments, one per chunk, in endless mode.
+static int trackStreamChunk[STREAM_CHUNKS]; // Chunk whose segment each ring slot holds.
+static unsigned int asteroidProgram, asteroidVao, cubeVbo, instanceVbo; // Instanced asteroid drawing.
+static int instanceCapacity = 0; // Number of asteroids instanceVbo has room for.
+static int uploadedFieldVersion = -1; // fieldVersion of the data in instanceVbo.
+static int uploadedCount = 0; // Number of asteroids in instanceVbo.
+static std::vector<int> asteroidRuns[2]; // Visible runs of instances in the left and right viewports.
+static int asteroidRunsVersion[2] = { -1, -1 }; // uploadedFieldVersion the runs were culled for.
+static float asteroidMinY, asteroidMaxY; // Vertical extent of the uploaded asteroids.
+static glm::mat4 projection; // Projection set in resize(), kept for culling.
+static Frustum viewFrustum; // Volume seen by the camera of the current viewport.
+static int asteroidsDrawn[2], asteroidsCulled[2]; // Last frame's counts for the left and right viewports.
+
+// Routine to count the number of frames drawn every second, and to report the frame
+// time percentiles every STATS_REPORT_SECONDS seconds and the time of the last restart.
 void frameCounter(int value)
 {
+   long long restart = restartMicroseconds.exchange(-1);
+
    if (value != 0) // No output the first time frameCounter() is called (from main()).
-	  std::cout << "FPS = " << frameCount << std::endl;
+	  std::cout << "FPS = " << frameCount
+	            << ", asteroids drawn/culled: left " << asteroidsDrawn[0] << "/" << asteroidsCulled[0]
+	            << ", right " << asteroidsDrawn[1] << "/" << asteroidsCulled[1] << std::endl;
+   if (restart >= 0) std::cout << "Restart took " << restart / 1000.0 << " ms" << std::endl;
+   if (value != 0 && value % STATS_REPORT_SECONDS == 0) frameStats.report(std::cout);
    frameCount = 0;
-   glutTimerFunc(1000, frameCounter, 1);
-}
-
-// Function to check if two spheres centered at (x1,y1,z1) and (x2,y2,z2) with
-// radius r1 and r2 intersect.
-int checkSpheresIntersection(float x1, float y1, float z1, float r1,
-                             float x2, float y2, float z2, float r2)
-{
-    return ((x1 - x2)*(x1 - x2) + (y1 - y2)*(y1 - y2) + (z1 - z2)*(z1 - z2) <= (r1 + r2)*(r1 + r2));
+   glutTimerFunc(1000, frameCounter, value + 1);
 }
 
 // Function to draw the hitbox of the car.
@@ -137,291 +135,553 @@ void drawHitbox(float x, float y, float z, float radius)
     // Draw the sphere.
     glPushMatrix();
     glTranslatef(x, y, z);
-    glutWireSphere(radius, 16, 16);
+    drawWireSphere(radius, 16, 16);
     glPopMatrix();
 }
 
-int CarCraftCollision(float x, float z, float a)
+// Vertex of the baked track geometry: position and color, interleaved.
+struct TrackVertex
 {
-    int i, j;
-
-    // Check for collision with each asteroid.
-    for (j = 0; j<COLUMNS; j++)
-        for (i = 0; i<ROWS; i++)
-            if (arrayAsteroids[i][j].getRadius() > 0) // If asteroid exists.
-                if (checkSpheresIntersection(x - 5 * sin((M_PI / 180.0) * a), 0.0,
-                                             z - 5 * cos((M_PI / 180.0) * a), 1.5,
-                                             arrayAsteroids[i][j].getCenterX(), arrayAsteroids[i][j].getCenterY(),
-                                             arrayAsteroids[i][j].getCenterZ(), arrayAsteroids[i][j].getRadius()))
-                    return 1;
-    return 0;
-}
+    float x, y, z;
+    unsigned char color[4];
+};
 
-// Function to check if the car is off the track.
-int isOffTrack(float x, float angle)
+// Function to append a quad, given by its corners in order, as two triangles.
+void addTrackQuad(std::vector<TrackVertex> &vertices, const float corners[4][3],
+                  float r, float g, float b)
 {
-    // Declare the track boundaries.
-    float trackLeftBoundary;
-    float trackRightBoundary;
+    static const int order[6] = { 0, 1, 2, 0, 2, 3 };
 
-    // Check if the car's x-coordinate is outside the track boundaries.
-    if (angle<=30 && angle>= -30){
-        trackLeftBoundary = -40.0-SIZE;
-        trackRightBoundary = 40.0+SIZE;
-    }else{
-        trackLeftBoundary = -40.0;
-        trackRightBoundary = 40.0;
+    for (int k = 0; k < 6; k++)
+    {
+        TrackVertex vertex;
+        vertex.x = corners[order[k]][0];
+        vertex.y = corners[order[k]][1];
+        vertex.z = corners[order[k]][2];
+        vertex.color[0] = (unsigned char)(r * 255.0 + 0.5);
+        vertex.color[1] = (unsigned char)(g * 255.0 + 0.5);
+        vertex.color[2] = (unsigned char)(b * 255.0 + 0.5);
+        vertex.color[3] = 255;
+        vertices.push_back(vertex);
     }
+}
 
-    // Check if the car's x-coordinate is outside the track boundaries.
-    if (x < trackLeftBoundary || x > trackRightBoundary)
+// Function to bake the track, barriers and start/finish lines into a vertex buffer.
+// The geometry never changes, so this runs once. In endless mode the buffer only holds
+// the start area and the rest of the track is streamed with the asteroid chunks.
+void buildTrackBuffer(void)
+{
+    std::vector<TrackVertex> vertices;
+    float end = endlessMode ? getChunkStartZ(0) : -30.0 * ROWS - 20.0; // Far end of the track.
+
+    // The track.
+    float track[4][3] = { { -40.0-SIZE, -SIZE, end }, { 40.0+SIZE, -SIZE, end },
+                          { 40.0+SIZE, -SIZE, 120.0 }, { -40.0-SIZE, -SIZE, 120.0 } };
+    addTrackQuad(vertices, track, 0.5, 0.5, 0.5); // Grey.
+
+    // The barriers.
+    float leftBarrier[4][3] = { { -40.0-SIZE, -SIZE, end }, { -40.0-SIZE, SIZE, end },
+                                { -40.0-SIZE, SIZE, 140.0 }, { -40.0-SIZE, -SIZE, 140.0 } };
+    float rightBarrier[4][3] = { { 40.0+SIZE, -SIZE, end }, { 40.0+SIZE, SIZE, end },
+                                 { 40.0+SIZE, SIZE, 130.0 }, { 40.0+SIZE, -SIZE, 130.0 } };
+    addTrackQuad(vertices, leftBarrier, 34.0/255, 139.0/255, 230.0/255); // Blue.
+    addTrackQuad(vertices, rightBarrier, 34.0/255, 139.0/255, 230.0/255);
+
+    // The starting and finish lines as series of black and white tiles.
+    for (int i = -40-SIZE; i < 40+SIZE; i += 2)
     {
-        return 1;
+        float shade = (i % 4 == 0) ? 1.0 : 0.0; // White or black.
+        float start[4][3] = { { (float)i, -SIZE+1, 100.0 }, { i + 2.0f, -SIZE+1, 100.0 },
+                              { i + 2.0f, -SIZE+1, 130.0 }, { (float)i, -SIZE+1, 130.0 } };
+        float finish[4][3] = { { (float)i, -SIZE+0.1, -30.0 * ROWS - 20.0 }, { i + 2.0f, -SIZE+0.1, -30.0 * ROWS - 20.0 },
+                               { i + 2.0f, -SIZE+0.1, -30.0 * ROWS }, { (float)i, -SIZE+0.1, -30.0 * ROWS } };
+        addTrackQuad(vertices, start, shade, shade, shade);
+        if (!endlessMode) addTrackQuad(vertices, finish, shade, shade, shade);
     }
 
-    return  0;
+    glGenVertexArrays(1, &trackVao);
+    glGenBuffers(1, &trackVbo);
+    glBindVertexArray(trackVao);
+    glBindBuffer(GL_ARRAY_BUFFER, trackVbo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TrackVertex), vertices.data(), GL_STATIC_DRAW);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(TrackVertex), (void *)offsetof(TrackVertex, x));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TrackVertex), (void *)offsetof(TrackVertex, color));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    trackVertexCount = (int)vertices.size();
 }
 
-// Function to check if two cubes intersect.
-int checkCubesIntersection(float x1, float y1, float z1, float s1,
-                           float x2, float y2, float z2, float s2)
+#define SEGMENT_VERTICES 18 // Vertices of a streamed track segment: the track and two barriers.
+
+// Function to create the ring buffer of streamed track segments for endless mode.
+void buildTrackStreamBuffer(void)
 {
-    return (abs(x1 - x2) * 2 < (s1 + s2)) &&
-           (abs(y1 - y2) * 2 < (s1 + s2)) &&
-           (abs(z1 - z2) * 2 < (s1 + s2));
+    glGenVertexArrays(1, &trackStreamVao);
+    glGenBuffers(1, &trackStreamVbo);
+    glBindVertexArray(trackStreamVao);
+    glBindBuffer(GL_ARRAY_BUFFER, trackStreamVbo);
+    glBufferData(GL_ARRAY_BUFFER, STREAM_CHUNKS * SEGMENT_VERTICES * sizeof(TrackVertex), NULL, GL_DYNAMIC_DRAW);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(TrackVertex), (void *)offsetof(TrackVertex, x));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TrackVertex), (void *)offsetof(TrackVertex, color));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    for (int slot = 0; slot < STREAM_CHUNKS; slot++) trackStreamChunk[slot] = -1;
 }
 
-// Initialization routine.
-void setup(void)
+// Function to rewrite the ring slots whose chunk has been recycled since they were
+// written, with the track and barriers alongside their new chunk.
+void streamTrack(void)
 {
-    int i, j, k, l;
+    static std::vector<TrackVertex> vertices;
 
-    car = glGenLists(1);
-    glNewList(car, GL_COMPILE);
-    //car body
-    glPushMatrix();
-    glColor3f(41.0 / 255.0, 60.0 / 255.0, 139.0 / 255.0);
-    glTranslatef(0.0, 0.0, -2.0);
-    glScalef(1.88, 0.5, 0.8); // Scale down the car.
-    glutSolidCube(10.0);
-    glPopMatrix();
-
-    //car roof
-    glPushMatrix();
-    glColor3f(43.0 / 255.0, 62.0 / 255.0, 130 / 255.0);
-    glTranslatef(-2.0, 5.0, -2.0);
-    glScalef(1.5, 0.8, 1.0); // Scale down the car part.
-    glutSolidCube(5.0);
-    glPopMatrix();
+    glBindBuffer(GL_ARRAY_BUFFER, trackStreamVbo);
+    for (int slot = 0; slot < STREAM_CHUNKS; slot++)
+    {
+        int c = getStreamChunk(slot);
+        if (c < 0 || c == trackStreamChunk[slot]) continue;
+
+        float nearZ = getChunkStartZ(c), farZ = getChunkStartZ(c + 1);
+        float track[4][3] = { { -40.0-SIZE, -SIZE, farZ }, { 40.0+SIZE, -SIZE, farZ },
+                              { 40.0+SIZE, -SIZE, nearZ }, { -40.0-SIZE, -SIZE, nearZ } };
+        float leftBarrier[4][3] = { { -40.0-SIZE, -SIZE, farZ }, { -40.0-SIZE, SIZE, farZ },
+                                    { -40.0-SIZE, SIZE, nearZ }, { -40.0-SIZE, -SIZE, nearZ } };
+        float rightBarrier[4][3] = { { 40.0+SIZE, -SIZE, farZ }, { 40.0+SIZE, SIZE, farZ },
+                                     { 40.0+SIZE, SIZE, nearZ }, { 40.0+SIZE, -SIZE, nearZ } };
+        vertices.clear();
+        addTrackQuad(vertices, track, 0.5, 0.5, 0.5);
+        addTrackQuad(vertices, leftBarrier, 34.0/255, 139.0/255, 230.0/255);
+        addTrackQuad(vertices, rightBarrier, 34.0/255, 139.0/255, 230.0/255);
+
+        glBufferSubData(GL_ARRAY_BUFFER, slot * SEGMENT_VERTICES * sizeof(TrackVertex),
+                        SEGMENT_VERTICES * sizeof(TrackVertex), vertices.data());
+        trackStreamChunk[slot] = c;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
 
-    //car side windows
-    glPushMatrix();
-    glColor3f(106.0 / 255.0, 178.0 / 255.0, 197.0 / 255.0);
-    glTranslatef(0.0, 5.0, -2.0);
-    glScalef(0.6, 0.7, 1.1); // Scale down the car part.
-    glutSolidCube(5.0);
-    glPopMatrix();
+// Vertex of the baked car model.
+struct CarVertex
+{
+    float x, y, z;
+    float nx, ny, nz;
+    unsigned char color[4];
+};
 
+// A part of the car model: a solid cube of side size, or a wheel if size is 0, scaled
+// and then moved into place.
+struct CarPart
+{
+    float r, g, b;
+    float translate[3];
+    float scale[3];
+    float size;
+};
 
-    //car side windows
-    glPushMatrix();
-    glColor3f(106.0 / 255.0, 178.0 / 255.0, 197.0 / 255.0);
-    glTranslatef(-4.0, 5.0, -2.0);
-    glScalef(0.6, 0.7, 1.1); // Scale down the car part.
-    glutSolidCube(5.0);
-    glPopMatrix();
+static const CarPart carParts[] =
+{
+    { 41.0/255, 60.0/255, 139.0/255, { 0.0, 0.0, -2.0 }, { 1.88, 0.5, 0.8 }, 10.0 }, // Body.
+    { 43.0/255, 62.0/255, 130.0/255, { -2.0, 5.0, -2.0 }, { 1.5, 0.8, 1.0 }, 5.0 }, // Roof.
+    { 106.0/255, 178.0/255, 197.0/255, { 0.0, 5.0, -2.0 }, { 0.6, 0.7, 1.1 }, 5.0 }, // Side windows.
+    { 106.0/255, 178.0/255, 197.0/255, { -4.0, 5.0, -2.0 }, { 0.6, 0.7, 1.1 }, 5.0 },
+    { 106.0/255, 178.0/255, 197.0/255, { 0.0, 5.0, -2.0 }, { 0.85, 0.7, 0.7 }, 5.0 }, // Front window.
+    { 106.0/255, 178.0/255, 197.0/255, { -3.88, 5.0, -2.0 }, { 0.85, 0.7, 0.7 }, 5.0 }, // Back window.
+    { 82.0/255, 76.0/255, 82.0/255, { -5.0, -2.5, 0.5 }, { 0.5, 0.5, 0.5 }, 0.0 }, // Wheels.
+    { 82.0/255, 76.0/255, 82.0/255, { 5.0, -2.5, 0.5 }, { 0.5, 0.5, 0.5 }, 0.0 },
+    { 82.0/255, 76.0/255, 82.0/255, { -5.0, -2.5, -7.0 }, { 0.5, 0.5, 0.5 }, 0.0 },
+    { 82.0/255, 76.0/255, 82.0/255, { 5.0, -2.5, -7.0 }, { 0.5, 0.5, 0.5 }, 0.0 },
+};
 
-    //car front window
-    glPushMatrix();
-    glColor3f(106.0 / 255.0, 178.0 / 255.0, 197.0 / 255.0);
-    glTranslatef(0.0, 5.0, -2.0);
-    glScalef(0.85, 0.7, 0.7); // Scale down the car part.
-    glutSolidCube(5.0);
-    glPopMatrix();
+// Function to bake the car parts into one indexed vertex buffer with a color per vertex,
+// so the car is drawn with a single call. Vertices the parts share after moving them
+// into place, same position, normal and color, are stored once. The triangles keep the
+// order the parts were drawn in, so overlapping parts still cover each other the same way.
+void buildCarBuffer(void)
+{
+    std::vector<CarVertex> vertices;
+    std::vector<unsigned int> indices;
+    std::unordered_map<std::string, unsigned int> vertexIndex; // Vertex bytes to index.
+    ShapeMesh mesh;
 
+    for (size_t p = 0; p < sizeof(carParts) / sizeof(carParts[0]); p++)
+    {
+        const CarPart &part = carParts[p];
+        mesh.vertices.clear();
+        mesh.normals.clear();
+        mesh.indices.clear();
+        if (part.size > 0.0) generateSolidCube(part.size, mesh);
+        else generateSolidCylinder(5.0, 5.0, 16, 16, mesh);
+
+        for (size_t k = 0; k < mesh.indices.size(); k++)
+        {
+            const float *position = &mesh.vertices[3 * mesh.indices[k]];
+            const float *normal = &mesh.normals[3 * mesh.indices[k]];
+            glm::vec3 n = glm::normalize(glm::vec3(normal[0] / part.scale[0], normal[1] / part.scale[1],
+                                                   normal[2] / part.scale[2]));
+
+            // Adding 0 turns -0 into 0, so equal vertices have equal bytes.
+            CarVertex vertex;
+            vertex.x = position[0] * part.scale[0] + part.translate[0] + 0.0f;
+            vertex.y = position[1] * part.scale[1] + part.translate[1] + 0.0f;
+            vertex.z = position[2] * part.scale[2] + part.translate[2] + 0.0f;
+            vertex.nx = n.x + 0.0f;
+            vertex.ny = n.y + 0.0f;
+            vertex.nz = n.z + 0.0f;
+            vertex.color[0] = (unsigned char)(part.r * 255.0 + 0.5);
+            vertex.color[1] = (unsigned char)(part.g * 255.0 + 0.5);
+            vertex.color[2] = (unsigned char)(part.b * 255.0 + 0.5);
+            vertex.color[3] = 255;
+
+            std::string key((const char *)&vertex, sizeof(vertex));
+            std::unordered_map<std::string, unsigned int>::iterator found = vertexIndex.find(key);
+            if (found == vertexIndex.end())
+            {
+                found = vertexIndex.insert(std::make_pair(key, (unsigned int)vertices.size())).first;
+                vertices.push_back(vertex);
+            }
+            indices.push_back(found->second);
+        }
+    }
 
-    //car back window
-    glPushMatrix();
-    glColor3f(106.0 / 255.0, 178.0 / 255.0, 197.0 / 255.0);
-    glTranslatef(-3.88, 5.0, -2.0);
-    glScalef(0.85, 0.7, 0.7); // Scale down the car part.
-    glutSolidCube(5.0);
-    glPopMatrix();
+    glGenVertexArrays(1, &carVao);
+    glGenBuffers(1, &carVbo);
+    glGenBuffers(1, &carIbo);
+    glBindVertexArray(carVao);
+    glBindBuffer(GL_ARRAY_BUFFER, carVbo);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(CarVertex), vertices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, carIbo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(CarVertex), (void *)offsetof(CarVertex, x));
+    glNormalPointer(GL_FLOAT, sizeof(CarVertex), (void *)offsetof(CarVertex, nx));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(CarVertex), (void *)offsetof(CarVertex, color));
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    carIndexCount = (int)indices.size();
+}
 
-    //car wheels
-    glPushMatrix();
-    glColor3f(82.0 / 255.0, 76.0 / 255.0, 82.0 / 255.0);
-    glTranslatef(-5.0, -2.5, 0.5);
-    glScalef(0.5, 0.5, 0.5); // Scale down the car part.
-    glutSolidCylinder(5.0, 5.0, 16, 16);
-    glPopMatrix();
+// Function to draw the car at the origin of the current modelview matrix.
+void drawCar(void)
+{
+    glBindVertexArray(carVao);
+    glDrawElements(GL_TRIANGLES, carIndexCount, GL_UNSIGNED_INT, 0);
+    glBindVertexArray(0);
+}
 
+// Per-asteroid data of the instanced draw: center and size, then color.
+struct AsteroidInstance
+{
+    float x, y, z, size;
+    unsigned char color[4];
+};
 
-    glPushMatrix();
-    glColor3f(82.0 / 255.0, 76.0 / 255.0, 82.0 / 255.0);
-    glTranslatef(5.0, -2.5, 0.5);
-    glScalef(0.5, 0.5, 0.5); // Scale down the car part.
-    glutSolidCylinder(5.0, 5.0, 16, 16);
-    glPopMatrix();
+// Shaders placing a unit cube at each asteroid, colored like glutSolidCube with
+// glColor and no lighting.
+static const char *asteroidVertexShader =
+    "#version 150 compatibility\n"
+    "in vec3 position;\n"
+    "in vec4 instance;\n"
+    "in vec4 color;\n"
+    "out vec4 asteroidColor;\n"
+    "void main()\n"
+    "{\n"
+    "    asteroidColor = color;\n"
+    "    gl_Position = gl_ModelViewProjectionMatrix * vec4(instance.xyz + position * instance.w, 1.0);\n"
+    "}\n";
+static const char *asteroidFragmentShader =
+    "#version 150 compatibility\n"
+    "in vec4 asteroidColor;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = asteroidColor;\n"
+    "}\n";
+
+// Function to create the program, the unit cube and the instance buffer for asteroids.
+void buildAsteroidBuffers(void)
+{
+    static const char *attributes[] = { "position", "instance", "color", NULL };
+    static const float corners[8][3] = { { -0.5, -0.5, -0.5 }, { 0.5, -0.5, -0.5 }, { 0.5, 0.5, -0.5 },
+                                         { -0.5, 0.5, -0.5 }, { -0.5, -0.5, 0.5 }, { 0.5, -0.5, 0.5 },
+                                         { 0.5, 0.5, 0.5 }, { -0.5, 0.5, 0.5 } };
+    static const int faces[6][4] = { { 0, 3, 2, 1 }, { 4, 5, 6, 7 }, { 0, 1, 5, 4 },
+                                     { 3, 7, 6, 2 }, { 0, 4, 7, 3 }, { 1, 2, 6, 5 } };
+    static const int order[6] = { 0, 1, 2, 0, 2, 3 };
+    float cube[36][3];
+
+    for (int f = 0; f < 6; f++)
+        for (int k = 0; k < 6; k++)
+            for (int c = 0; c < 3; c++)
+                cube[6 * f + k][c] = corners[faces[f][order[k]]][c];
+
+    asteroidProgram = buildShaderProgram(asteroidVertexShader, asteroidFragmentShader, attributes);
+
+    glGenVertexArrays(1, &asteroidVao);
+    glGenBuffers(1, &cubeVbo);
+    glGenBuffers(1, &instanceVbo);
+    glBindVertexArray(asteroidVao);
+
+    glBindBuffer(GL_ARRAY_BUFFER, cubeVbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(cube), cube, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(AsteroidInstance),
+                          (void *)offsetof(AsteroidInstance, x));
+    glVertexAttribDivisor(1, 1);
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(AsteroidInstance),
+                          (void *)offsetof(AsteroidInstance, color));
+    glVertexAttribDivisor(2, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
 
+// Function to copy the asteroid field into the instance buffer. Only runs when the
+// field has changed since the last upload.
+void uploadAsteroidInstances(void)
+{
+    static std::vector<AsteroidInstance> instances;
+    const float *centerX = asteroidField.getCenterX(), *centerY = asteroidField.getCenterY();
+    const float *centerZ = asteroidField.getCenterZ(), *radius = asteroidField.getRadius();
+    const unsigned char *color = asteroidField.getColor();
+    int count = asteroidField.getCount();
 
-    glPushMatrix();
-    glColor3f(82.0 / 255.0, 76.0 / 255.0, 82.0 / 255.0);
-    glTranslatef(-5.0, -2.5, -7.0);
-    glScalef(0.5, 0.5, 0.5); // Scale down the car part.
-    glutSolidCylinder(5.0, 5.0, 16, 16);
-    glPopMatrix();
+    if (uploadedFieldVersion == fieldVersion) return;
 
+    instances.resize(count);
+    asteroidMinY = asteroidMaxY = 0.0;
+    for (int k = 0; k < count; k++)
+    {
+        // A cube of side radius[k] reaches no further than this from its center.
+        float reach = 0.8660254 * radius[k];
+        if (k == 0 || centerY[k] - reach < asteroidMinY) asteroidMinY = centerY[k] - reach;
+        if (k == 0 || centerY[k] + reach > asteroidMaxY) asteroidMaxY = centerY[k] + reach;
+
+        instances[k].x = centerX[k];
+        instances[k].y = centerY[k];
+        instances[k].z = centerZ[k];
+        instances[k].size = radius[k]; // drawSolidCube(radius) in the original drawing.
+        for (int c = 0; c < 4; c++) instances[k].color[c] = color[4 * k + c];
+    }
 
-    glPushMatrix();
-    glColor3f(82.0 / 255.0, 76.0 / 255.0, 82.0 / 255.0);
-    glTranslatef(5.0, -2.5, -7.0);
-    glScalef(0.5, 0.5, 0.5); // Scale down the car part.
-    glutSolidCylinder(5.0, 5.0, 16, 16);
-    glPopMatrix();
-    glEndList();
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+    if (count > instanceCapacity)
+    {
+        instanceCapacity = count;
+        glBufferData(GL_ARRAY_BUFFER, count * sizeof(AsteroidInstance), instances.data(), GL_STATIC_DRAW);
+    }
+    else if (count > 0)
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(AsteroidInstance), instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    uploadedFieldVersion = fieldVersion;
+    uploadedCount = count;
+}
 
-    // Initialize global arrayAsteroids.
-    for (j = 0; j<COLUMNS; j++)
+// Function to start a new level: new asteroids written over the existing arrays and
+// buffers, and the car back on the start line. Once the first level has been set up
+// this allocates nothing and creates no GL objects.
+void resetLevel(void)
+{
     {
-        for (i = 0; i<ROWS; i++)
-        {
-            if (rand() % 100 < FILL_PROBABILITY)
-            {
-                float x, y, z;
-                bool intersect;
-                do
-                {
-                    intersect = false;
-                    // Generate random positions for the new asteroid.
-                    x = rand() % 60 - 30;
-                    y = -2.0;
-                    z = 80.0 - 30.0*i;
-
-                    for (k = 0; k < i && !intersect; k++) {
-                        for (l = 0; l < COLUMNS; l++) {
-                            if (arrayAsteroids[k][l].getRadius() > 0) { // If asteroid exists.
-                                if (checkSpheresIntersection(arrayAsteroids[i][j].getCenterX(), arrayAsteroids[i][j].getCenterY(),
-                                                             arrayAsteroids[i][j].getCenterZ(), arrayAsteroids[i][j].getRadius(),
-                                                             arrayAsteroids[k][l].getCenterX(), arrayAsteroids[k][l].getCenterY(),
-                                                             arrayAsteroids[k][l].getCenterZ(), arrayAsteroids[k][l].getRadius()))
-                                {
-                                    intersect = true;
-                                }
-                            }
-                        }
-                    }
-                } while (intersect);
-
-                // Position the asteroid at the generated position.
-                arrayAsteroids[i][j] = Asteroid(x, y, z, SIZE,
-                                                rand() % 256, rand() % 256, rand() % 256);
-            }
-        }
+        std::lock_guard<std::mutex> lock(fieldMutex);
+        generateAsteroids();
     }
+    resetCar();
+    prevXVal = xVal;
+    prevZVal = zVal;
+    prevAngle = angle;
+    restartPending = 0;
+}
+
+// Initialization routine, run once. Creates every GL resource the game uses.
+void setup(void)
+{
+    PROFILE_FUNCTION();
+
+    // Bake the car model.
+    buildCarBuffer();
+
+    // Bake the static track geometry and create the asteroid buffers.
+    buildTrackBuffer();
+    if (endlessMode) buildTrackStreamBuffer();
+    buildAsteroidBuffers();
+    buildTextAtlas();
+
+    // Initialize the asteroid field.
+    resetLevel();
 
     glEnable(GL_DEPTH_TEST);
     glClearColor(0.0, 0.0, 0.0, 0.0);
 
-    glutTimerFunc(0, frameCounter, 0); // Initial call of frameCounter().
+    if (!offscreen) glutTimerFunc(0, frameCounter, 0); // Initial call of frameCounter().
 }
 
 // Function to draw the track.
 void drawTrack()
 {
-    // Draw the track.
-    glPushMatrix();
-    glColor3f(0.5, 0.5, 0.5); // Set the color to grey.
-    glBegin(GL_QUADS);
-    glVertex3f(-40.0-SIZE, -SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(40.0+SIZE, -SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(40.0+SIZE, -SIZE, 120.0);
-    glVertex3f(-40.0-SIZE, -SIZE, 120.0);
-    glEnd();
-    glPopMatrix();
+    PROFILE_FUNCTION();
 
-    // Draw the barriers.
-    glColor3f(34.0/255,139.0/255,230.0/255); // Set the color to red.
-    glBegin(GL_QUADS);
-    glVertex3f(-40.0-SIZE, -SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(-40.0-SIZE, SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(-40.0-SIZE, SIZE, 140.0);
-    glVertex3f(-40.0-SIZE, -SIZE, 140.0);
-    glVertex3f(40.0+SIZE, -SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(40.0+SIZE, SIZE, -30.0 * ROWS - 20.0);
-    glVertex3f(40.0+SIZE, SIZE, 130.0);
-    glVertex3f(40.0+SIZE, -SIZE, 130.0);
-    glEnd();
-
-    // Draw the starting line as a series of black and white tiles.
-    for (int i = -40-SIZE; i < 40+SIZE; i += 2)
-    {
-        if (i % 4 == 0)
-            glColor3f(1.0, 1.0, 1.0); // Set the color to white.
-        else
-            glColor3f(0.0, 0.0, 0.0); // Set the color to black.
-
-        glBegin(GL_QUADS);
-        glVertex3f(i, -SIZE+1, 100.0);
-        glVertex3f(i + 2, -SIZE+1, 100.0);
-        glVertex3f(i + 2, -SIZE+1, 130.0); // Extend the z-coordinate.
-        glVertex3f(i, -SIZE+1, 130.0); // Extend the z-coordinate.
-        glEnd();
-    }
+    // Draw the track, barriers and start/finish lines in one call.
+    glBindVertexArray(trackVao);
+    glDrawArrays(GL_TRIANGLES, 0, trackVertexCount);
+    glBindVertexArray(0);
 
-    // Draw the finish line as a series of black and white tiles.
-    for (int i = -40-SIZE; i < 40+SIZE; i += 2)
+    // Draw the track segments alongside the streamed chunks. If the simulation is busy
+    // rewriting the chunks, the segments catch up on a later frame.
+    if (endlessMode)
     {
-        if (i % 4 == 0)
-            glColor3f(1.0, 1.0, 1.0); // Set the color to white.
-        else
-            glColor3f(0.0, 0.0, 0.0); // Set the color to black.
-
-        glBegin(GL_QUADS);
-        glVertex3f(i, -SIZE+0.1, -30.0 * ROWS - 20.0);
-        glVertex3f(i + 2, -SIZE+0.1, -30.0 * ROWS - 20.0);
-        glVertex3f(i + 2, -SIZE+0.1, -30.0 * ROWS);
-        glVertex3f(i, -SIZE+0.1, -30.0 * ROWS);
-        glEnd();
+        std::unique_lock<std::mutex> lock(fieldMutex, std::try_to_lock);
+        if (lock.owns_lock()) streamTrack();
+        lock.unlock();
+
+        glBindVertexArray(trackStreamVao);
+        glDrawArrays(GL_TRIANGLES, 0, STREAM_CHUNKS * SEGMENT_VERTICES);
+        glBindVertexArray(0);
     }
 
     // Draw start text.
     glColor3f(1.0, 1.0, 1.0); // Set text color to white.
-    glRasterPos3f(-5.0, 10, 90.0); // Position for start text.
-    const char *startText = "Start Race";
-    for (int i = 0; startText[i] != '\0'; ++i)
-    {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, startText[i]);
-    }
+    drawText(TEXT_HELVETICA_18, -5.0, 10, 90.0, "Start Race");
 
     // Draw finish text.
-    glRasterPos3f(-5.0, 10, -30.0 * ROWS - 30.0); // Position for finish text.
-    const char *finishText = "Finish Line";
-    for (int i = 0; finishText[i] != '\0'; ++i)
+    if (!endlessMode)
+        drawText(TEXT_HELVETICA_18, -5.0, 10, -30.0 * ROWS - 30.0, "Finish Line");
+
+}
+
+// Function to point the camera like gluLookAt and record its view frustum for culling.
+void setCamera(float eyeX, float eyeY, float eyeZ, float centerX, float centerY, float centerZ)
+{
+    gluLookAt(eyeX, eyeY, eyeZ, centerX, centerY, centerZ, 0.0, 1.0, 0.0);
+
+    glm::mat4 view = glm::lookAt(glm::vec3(eyeX, eyeY, eyeZ), glm::vec3(centerX, centerY, centerZ),
+                                 glm::vec3(0.0, 1.0, 0.0));
+    viewFrustum.extract(glm::value_ptr(projection * view));
+}
+
+// Function to find the asteroids inside the current camera's frustum. The field is
+// sorted by grid cell, so the visible asteroids form a few runs of the instance buffer.
+void cullAsteroids(int viewport)
+{
+    std::vector<int> &runs = asteroidRuns[viewport]; // First instance and count of each visible run.
+    const float *centerX = asteroidField.getCenterX(), *centerY = asteroidField.getCenterY();
+    const float *centerZ = asteroidField.getCenterZ(), *radius = asteroidField.getRadius();
+    int drawn = 0;
+
+    // Append field indices [begin, end) to the runs, extending the last run if they follow it.
+    runs.clear();
+    auto addRun = [&](int begin, int end)
+    {
+        int last = (int)runs.size() - 2;
+        if (last >= 0 && runs[last] + runs[last + 1] == begin) runs[last + 1] += end - begin;
+        else
+        {
+            runs.push_back(begin);
+            runs.push_back(end - begin);
+        }
+        drawn += end - begin;
+    };
+
+    // Coarse test on grid cells, then per asteroid in cells crossing the frustum boundary.
+    asteroidGrid.visitCells([&](float x0, float z0, float x1, float z1)
     {
-        glutBitmapCharacter(GLUT_BITMAP_HELVETICA_18, finishText[i]);
+        return viewFrustum.testBox(x0, asteroidMinY, z0, x1, asteroidMaxY, z1);
+    },
+    [&](int begin, int end, bool inside)
+    {
+        if (inside)
+        {
+            addRun(begin, end);
+            return;
+        }
+        for (int k = begin; k < end; k++)
+            if (viewFrustum.sphereVisible(centerX[k], centerY[k], centerZ[k], 0.8660254 * radius[k]))
+                addRun(k, k + 1);
+    });
+
+    asteroidsDrawn[viewport] = drawn;
+    asteroidsCulled[viewport] = asteroidField.getCount() - drawn;
+    asteroidRunsVersion[viewport] = uploadedFieldVersion;
+}
+
+// Function to draw the asteroids in view, one instanced call per visible run. If the
+// simulation is rewriting the field, the last runs are drawn again, or every uploaded
+// asteroid if the runs no longer match the instance buffer.
+void drawAsteroids(int viewport)
+{
+    PROFILE_FUNCTION();
+
+    std::unique_lock<std::mutex> lock(fieldMutex, std::try_to_lock);
+    if (lock.owns_lock())
+    {
+        uploadAsteroidInstances();
+        cullAsteroids(viewport);
     }
+    lock.unlock();
 
+    glUseProgram(asteroidProgram);
+    glBindVertexArray(asteroidVao);
+    if (asteroidRunsVersion[viewport] == uploadedFieldVersion)
+    {
+        const std::vector<int> &runs = asteroidRuns[viewport];
+        for (size_t k = 0; k < runs.size(); k += 2)
+            glDrawArraysInstancedBaseInstance(GL_TRIANGLES, 0, 36, runs[k + 1], runs[k]);
+    }
+    else
+        glDrawArraysInstanced(GL_TRIANGLES, 0, 36, uploadedCount);
+    glBindVertexArray(0);
+    glUseProgram(0);
 }
 
-void restartGame(int value)
+// Routine to restart the game after a crash or finish, recording how long the reset took
+// for frameCounter() to report, as this runs on the simulation thread.
+void restartGame(void)
 {
-    // Reset game state.
-    xVal = 0;
-    zVal = 120;
-    angle = 0.0;
-    isCollision = 0;
+    PROFILE_FUNCTION();
 
-    // Restart the game.
-    setup();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Restart the game on the next level's field.
+    levelSeed++;
+    resetLevel();
+
+    restartMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
 }
 
 // Drawing routine.
 void drawScene(void)
 {
-   frameCount++; // Increment number of frames every redraw.
+   PROFILE_FUNCTION();
 
-   int i, j;
+   frameCount++; // Increment number of frames every redraw.
+   frameStats.beginFrame();
+
+   // Newest state published by the simulation thread.
+   snapshots.update();
+   const GameSnapshot &state = snapshots.readBuffer();
+
+   // Car interpolated between the last two simulation steps.
+   float alpha = std::chrono::duration<double>(std::chrono::steady_clock::now() - state.stepTime).count() * SIM_RATE;
+   if (alpha > 1.0) alpha = 1.0;
+   if (alpha < 0.0) alpha = 0.0;
+   float turn = state.angle - state.prevAngle;
+   if (turn > 180.0) turn -= 360.0;
+   if (turn < -180.0) turn += 360.0;
+   float carX = state.prevX + alpha * (state.x - state.prevX);
+   float carZ = state.prevZ + alpha * (state.z - state.prevZ);
+   float carAngle = state.prevAngle + alpha * turn;
+
+   frameStats.beginPhase(PHASE_VIEWPORT);
    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
    // Begin left viewport.
@@ -430,57 +690,59 @@ void drawScene(void)
 
 
     // Write text in isolated (i.e., before gluLookAt) translate block.
+    frameStats.beginPhase(PHASE_TEXT);
     glPushMatrix();
     glColor3f(1.0, 0.0, 0.0);
-    if (isCollision)
+    if (state.isCollision)
     {
-        glRasterPos3f(-5.0, 0.0, -30.0); // Position for "GAMEOVER" text.
-        writeBitmapString((void*)font, "GAMEOVER");
+        drawText(TEXT_TIMES_ROMAN_24, -5.0, 0.0, -30.0, "GAMEOVER");
     }
     glPopMatrix();
 
     glPopMatrix();
 
     // third-person POV .
-    gluLookAt(xVal, 30.0, zVal + 30.0, xVal, 0.0, zVal, 0.0, 1.0, 0.0);
+    frameStats.beginPhase(PHASE_VIEWPORT);
+    setCamera(carX, 30.0, carZ + 30.0, carX, 0.0, carZ);
 
    // Draw the track.
+   frameStats.beginPhase(PHASE_TRACK);
    drawTrack();
 
-   // Draw all the asteroids in arrayAsteroids.
-   for (j = 0; j<COLUMNS; j++)
-      for (i = 0; i<ROWS; i++)
-         arrayAsteroids[i][j].draw();
+   // Draw the asteroids in view.
+   frameStats.beginPhase(PHASE_ASTEROIDS);
+   drawAsteroids(0);
 
     // Draw car and hit-box.
+    frameStats.beginPhase(PHASE_CAR);
     glPushMatrix();
-    glTranslatef(xVal, 0.0, zVal);
-    glRotatef(angle+90, 0.0, 1.0, 0.0);
-    glCallList(car);
+    glTranslatef(carX, 0.0, carZ);
+    glRotatef(carAngle+90, 0.0, 1.0, 0.0);
+    drawCar();
     glPopMatrix();
 
 
     // Check if the car has crossed the finish line.
-    if (zVal <= -30.0 * ROWS)
+    frameStats.beginPhase(PHASE_TEXT);
+    if (state.finished)
     {
         // Write text in isolated (i.e., before gluLookAt) translate block.
         glPushMatrix();
         glColor3f(0.0, 1.0, 0.0); // Set the color to green.
-        glRasterPos3f(-5.0, 0.0, -40.0); // Position for "CONGRATULATIONS!" text.
-        writeBitmapString((void*)font, "CONGRATULATIONS!");
+        drawText(TEXT_TIMES_ROMAN_24, -5.0, 0.0, -40.0, "CONGRATULATIONS!");
         glPopMatrix();
-        // Wait for 3 seconds before restarting the game.
-        glutTimerFunc(3000, restartGame, 0);
     }
 
+    frameStats.beginPhase(PHASE_CAR);
     glPushMatrix();
-    glTranslatef(xVal, 0.0, zVal);
-    glRotatef(angle, 0.0, 1.0, 0.0);
+    glTranslatef(carX, 0.0, carZ);
+    glRotatef(carAngle, 0.0, 1.0, 0.0);
 //    drawHitbox(0.0, 0.0, 0.0, 10.0); // Assuming the radius of the car is 10.0
     glPopMatrix();
     // End left viewport.
 
     // Begin right viewport.
+   frameStats.beginPhase(PHASE_VIEWPORT);
    glViewport(width / 2.0, 0, width / 2.0, height);
    glLoadIdentity();
 
@@ -494,53 +756,55 @@ void drawScene(void)
    glLineWidth(1.0);
 
 // Locate the camera at the tip of the cone and pointing in the direction of the cone.
-    gluLookAt(xVal - 10 * sin((M_PI / 180.0) * angle),
+    setCamera(carX - 10 * sin((M_PI / 180.0) * carAngle),
               0.0,
-              zVal - 10 * cos((M_PI / 180.0) * angle),
-              xVal - 11 * sin((M_PI / 180.0) * angle),
+              carZ - 10 * cos((M_PI / 180.0) * carAngle),
+              carX - 11 * sin((M_PI / 180.0) * carAngle),
               0.0,
-              zVal - 11 * cos((M_PI / 180.0) * angle),
-              0.0,
-              1.0,
-              0.0);
+              carZ - 11 * cos((M_PI / 180.0) * carAngle));
 
     // Write text in isolated (i.e., before gluLookAt) translate block.
+    frameStats.beginPhase(PHASE_TEXT);
     glPushMatrix();
     glColor3f(1.0, 0.0, 0.0);
-    if (isCollision)
+    if (state.isCollision)
     {
         // Position for "GAMEOVER" text relative to the camera's position and orientation.
-        glRasterPos3f(xVal-2, 0.0, zVal-15); // Position for "GAMEOVER" text.
-        writeBitmapString((void*)font, "GAMEOVER");
+        drawText(TEXT_TIMES_ROMAN_24, carX-2, 0.0, carZ-15, "GAMEOVER");
         // Wait for 3 seconds before restarting the game.
 
     }
     glPopMatrix();
 
    // Draw the track.
+   frameStats.beginPhase(PHASE_TRACK);
    drawTrack();
 
 
     // Check if the car has crossed the finish line.
-    if (zVal <= -30.0 * ROWS)
+    frameStats.beginPhase(PHASE_TEXT);
+    if (state.finished)
     {
         // Write text in isolated (i.e., before gluLookAt) translate block.
         glPushMatrix();
         glColor3f(0.0, 1.0, 0.0); // Set the color to green.
-        glRasterPos3f(xVal, 0.0, zVal-15); // Position for "CONGRATULATIONS!" text.
-        writeBitmapString((void*)font, "CONGRATULATIONS!");
+        drawText(TEXT_TIMES_ROMAN_24, carX, 0.0, carZ-15, "CONGRATULATIONS!");
         glPopMatrix();
-        // Wait for 3 seconds before restarting the game.
-        glutTimerFunc(3000, restartGame, 0);
     }
 
-   // Draw all the asteroids in arrayAsteroids.
-   for (j = 0; j<COLUMNS; j++)
-    for (i = 0; i<ROWS; i++)
-     arrayAsteroids[i][j].draw();
+   // Draw the asteroids in view.
+   frameStats.beginPhase(PHASE_ASTEROIDS);
+   drawAsteroids(1);
    // End right viewport.
 
-   glutSwapBuffers();
+   // Draw the text queued in both viewports.
+   frameStats.beginPhase(PHASE_TEXT);
+   flushText(width, height);
+
+   frameStats.beginPhase(PHASE_SWAP);
+   if (offscreen) glFinish(); // Wait until the frame is drawn, as the swap would.
+   else glutSwapBuffers();
+   frameStats.endFrame();
 }
 
 // OpenGL window reshape routine.
@@ -550,6 +814,7 @@ void resize(int w, int h)
 	glMatrixMode(GL_PROJECTION);
 	glLoadIdentity();
 	glFrustum(-5.0, 5.0, -5.0, 5.0, 5.0, 250.0);
+	projection = glm::frustum(-5.0f, 5.0f, -5.0f, 5.0f, 5.0f, 250.0f);
 	glMatrixMode(GL_MODELVIEW);
 
 	// Pass the size of the OpenGL window.
@@ -559,12 +824,106 @@ void resize(int w, int h)
 
 
 
+// Function to wait RESTART_DELAY seconds before restarting the game.
+void scheduleRestart(void)
+{
+    if (!restartPending)
+    {
+        restartPending = 1;
+        restartSteps = RESTART_DELAY * SIM_RATE; // Counted in steps, so scripted runs restart on the same frame.
+    }
+}
+
+// Function to advance the game by one fixed step. Runs on the simulation thread.
+void simulationStep(void)
+{
+    PROFILE_FUNCTION();
+
+    if (restartPending && --restartSteps < 0) restartGame();
+
+    prevXVal = xVal;
+    prevZVal = zVal;
+    prevAngle = angle;
+
+    // Apply each arrow key that is held or was tapped since the last step. The car
+    // stays put while a restart is pending.
+    for (int k = 0; k < 4; k++)
+    {
+        if (keyPressed[k].exchange(0) + keyDown[k] > 0 && !restartPending)
+        {
+            int blocked;
+            {
+                // Moving may stream new asteroid chunks in.
+                std::lock_guard<std::mutex> lock(fieldMutex);
+                blocked = moveCar((CarInput)k);
+            }
+            if (blocked) scheduleRestart(); // Hit an asteroid or the track edge.
+        }
+    }
+
+    if (crossedFinishLine()) scheduleRestart();
+}
+
+// Function to publish the state after the last step for drawScene().
+void publishSnapshot(std::chrono::steady_clock::time_point stepTime)
+{
+    GameSnapshot &state = snapshots.writeBuffer();
+
+    state.prevX = prevXVal;
+    state.prevZ = prevZVal;
+    state.prevAngle = prevAngle;
+    state.x = xVal;
+    state.z = zVal;
+    state.angle = angle;
+    state.isCollision = isCollision;
+    state.finished = crossedFinishLine();
+    state.stepTime = stepTime;
+    snapshots.publish();
+}
+
+// Simulation thread: runs the steps that are due, publishes the result and sleeps
+// until the next step. Drawing never waits for it and it never waits for drawing.
+void simulationLoop(void)
+{
+    PROFILE_THREAD("simulation");
+
+    while (simRunning)
+    {
+        int steps = simClock.advance();
+        double late = simClock.alpha() * simClock.getStep(); // Time since the last step was due.
+
+        for (int k = 0; k < steps; k++) simulationStep();
+        if (steps > 0)
+            publishSnapshot(std::chrono::steady_clock::now() -
+                            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(late)));
+
+        std::this_thread::sleep_for(std::chrono::duration<double>(simClock.getStep() - late));
+    }
+}
+
+// Function to start the simulation thread.
+void startSimulation(void)
+{
+    publishSnapshot(std::chrono::steady_clock::now());
+    simRunning = 1;
+    simThread = std::thread(simulationLoop);
+}
+
+// Function to stop the simulation thread and wait for it.
+void stopSimulation(void)
+{
+    simRunning = 0;
+    if (simThread.joinable()) simThread.join();
+}
+
 // Keyboard input processing routine.
 void keyInput(unsigned char key, int x, int y)
 {
     switch (key)
     {
         case 27:
+            stopSimulation();
             exit(0);
             break;
         default:
@@ -572,58 +931,147 @@ void keyInput(unsigned char key, int x, int y)
     }
 }
 
+// Function to map an arrow key to car input, or -1 for other keys.
+int carInputForKey(int key)
+{
+    if (key == GLUT_KEY_LEFT) return CAR_TURN_LEFT;
+    if (key == GLUT_KEY_RIGHT) return CAR_TURN_RIGHT;
+    if (key == GLUT_KEY_UP) return CAR_FORWARD;
+    if (key == GLUT_KEY_DOWN) return CAR_BACKWARD;
+    return -1;
+}
+
 // Callback routine for non-ASCII key entry.
 void specialKeyInput(int key, int x, int y)
 {
-    float tempxVal = xVal, tempzVal = zVal, tempAngle = angle;
+    int input = carInputForKey(key);
 
-    // Compute next position.
-    if (key == GLUT_KEY_LEFT) tempAngle = angle + 5.0;
-    if (key == GLUT_KEY_RIGHT) tempAngle = angle - 5.0;
-    if (key == GLUT_KEY_UP)
-    {
-        tempxVal = xVal - sin(tempAngle * M_PI / 180.0);
-        tempzVal = zVal - cos(tempAngle * M_PI / 180.0);
-    }
-    if (key == GLUT_KEY_DOWN)
+    // Held keys are applied by the simulation steps.
+    if (input >= 0)
     {
-        tempxVal = xVal + sin(tempAngle * M_PI / 180.0);
-        tempzVal = zVal + cos(tempAngle * M_PI / 180.0);
+        keyDown[input] = 1;
+        keyPressed[input] = 1;
     }
+}
+
+// Callback routine for non-ASCII key release.
+void specialKeyUp(int key, int x, int y)
+{
+    int input = carInputForKey(key);
 
-    // Angle correction.
-    if (tempAngle > 360.0) tempAngle -= 360.0;
-    if (tempAngle < 0.0) tempAngle += 360.0;
+    if (input >= 0) keyDown[input] = 0;
+}
+
+// Idle routine to redraw as often as possible.
+void idle(void)
+{
+    glutPostRedisplay();
+}
+
+#ifdef OFFSCREEN_RENDERING
+// Input of the offscreen run, one key press per frame: forward with a gentle weave.
+static const char *offscreenScript = "UUUUUUUUUULUUUUUUUUUUUUUUUURUUUUUUUUUURUUUUUUUUUUUUUUUULUUUUUUUUUU";
+
+// Function to draw frames frames into an offscreen framebuffer and report their times.
+// The car follows offscreenScript, one simulation step per frame, on the field of
+// levelSeed, so every run draws the same frames. No simulation thread is started.
+// With goldenDir, GOLDEN_CHECKS of the frames are compared with the golden images
+// there, or written there if updateGolden is set. Returns 1 if any frame did not match.
+int runOffscreen(int frames, const char *goldenDir, bool updateGolden)
+{
+    if (!createOffscreenContext(OFFSCREEN_WIDTH, OFFSCREEN_HEIGHT)) return 1;
+    glewExperimental = GL_TRUE;
+    glewInit();
+
+    resize(OFFSCREEN_WIDTH, OFFSCREEN_HEIGHT);
+    setup();
 
-    // Move car to next position only if there will not be collision with an asteroid or off the track.
-    if (!CarCraftCollision(tempxVal, tempzVal, tempAngle) && !isOffTrack(tempxVal, angle))
+    GoldenCheck golden(goldenDir ? goldenDir : ".", endlessMode ? "spaceTravelEndless" : "spaceTravel", updateGolden);
+    double seconds = 0.0, checkSeconds = 0.0; // Drawing time of all frames and of those since the last check.
+    int checkFrames = 0;
+    for (int k = 1; k <= frames; k++)
     {
-        isCollision = 0;
-        xVal = tempxVal;
-        zVal = tempzVal;
-        angle = tempAngle;
-    }
-    else {
-        isCollision = 1;
-        // Wait for 3 seconds before restarting the game.
-        glutTimerFunc(3000, restartGame, 0);
+        char key = offscreenScript[(k - 1) % strlen(offscreenScript)];
+        keyPressed[key == 'L' ? CAR_TURN_LEFT : key == 'R' ? CAR_TURN_RIGHT : CAR_FORWARD] = 1;
+        simulationStep();
+
+        // Published as if the step were long past, so the car is drawn where it ended.
+        publishSnapshot(std::chrono::steady_clock::time_point());
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        drawScene();
+        double frameSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        seconds += frameSeconds;
+        checkSeconds += frameSeconds;
+        checkFrames++;
+
+        if (goldenDir && k * GOLDEN_CHECKS / frames != (k - 1) * GOLDEN_CHECKS / frames)
+        {
+            golden.check(k, OFFSCREEN_WIDTH, OFFSCREEN_HEIGHT, 1000.0 * checkSeconds / checkFrames);
+            checkSeconds = 0.0;
+            checkFrames = 0;
+        }
     }
 
-    glutPostRedisplay();
+    std::cout << "Drew " << frames << " frames in " << seconds << " s, "
+              << frames / seconds << " frames per second" << std::endl;
+    frameStats.report(std::cout);
+    int failures = goldenDir ? golden.finish() : 0;
+    destroyOffscreenContext();
+    return failures > 0;
 }
+#endif
 
 // Routine to output interaction instructions to the C++ window.
 void printInteraction(void)
 {
 	std::cout << "Interaction:" << std::endl;
 	std::cout << "Press the left/right arrow keys to turn the craft." << std::endl
-		<< "Press the up/down arrow keys to move the craft." << std::endl;
+		<< "Press the up/down arrow keys to move the craft." << std::endl
+		<< "Start with --endless for a track with no finish line." << std::endl
+		<< "Start with --seed N to play the fields from seed N on." << std::endl
+		<< "Start with --frame-csv FILE to write the time of every frame to FILE." << std::endl
+		<< "Start with --offscreen N to draw N frames with no window and print their times." << std::endl
+		<< "Add --golden DIR to compare some of them with the golden images in DIR, or" << std::endl
+		<< "--update-golden DIR to write those images." << std::endl;
 }
 
 // Main routine.
 int main(int argc, char **argv)
 {
+	PROFILE_THREAD("main");
+	int offscreenFrames = 0;
+	const char *goldenDir = NULL; // Golden images of the offscreen frames.
+	bool updateGolden = false;
+
 	printInteraction();
+	for (int k = 1; k < argc; k++)
+	{
+		if (!strcmp(argv[k], "--endless")) endlessMode = 1;
+		else if (!strcmp(argv[k], "--frame-csv") && k + 1 < argc && !frameStats.openCsv(argv[++k]))
+			std::cerr << "Cannot write frame times to " << argv[k] << std::endl;
+		else if (!strcmp(argv[k], "--seed") && k + 1 < argc) levelSeed = atoi(argv[++k]);
+		else if (!strcmp(argv[k], "--offscreen") && k + 1 < argc) offscreenFrames = atoi(argv[++k]);
+		else if (!strcmp(argv[k], "--golden") && k + 1 < argc) goldenDir = argv[++k];
+		else if (!strcmp(argv[k], "--update-golden") && k + 1 < argc)
+		{
+			goldenDir = argv[++k];
+			updateGolden = true;
+		}
+	}
+
+	// Benchmark the drawing with no window, and without GLUT, which needs a window system.
+	if (offscreenFrames > 0)
+	{
+#ifdef OFFSCREEN_RENDERING
+		offscreen = 1;
+		return runOffscreen(offscreenFrames, goldenDir, updateGolden);
+#else
+		std::cerr << "Built without offscreen rendering, which needs EGL." << std::endl;
+		if (goldenDir) std::cerr << "Cannot " << (updateGolden ? "update" : "check") << " the golden images in " << goldenDir << std::endl;
+		return 1;
+#endif
+	}
+
 	glutInit(&argc, argv);
 
 	glutInitContextVersion(4, 3);
@@ -637,12 +1085,19 @@ int main(int argc, char **argv)
 	glutReshapeFunc(resize);
 	glutKeyboardFunc(keyInput);
 	glutSpecialFunc(specialKeyInput);
+	glutSpecialUpFunc(specialKeyUp);
+	glutIgnoreKeyRepeat(1);
+	glutIdleFunc(idle);
 
 	glewExperimental = GL_TRUE;
 	glewInit();
 
 	setup();
+	startSimulation();
 
+	// Return from the main loop when the window is closed, so the thread can be stopped.
+	glutSetOption(GLUT_ACTION_ON_WINDOW_CLOSE, GLUT_ACTION_GLUTMAINLOOP_RETURNS);
 	glutMainLoop();
+	stopSimulation();
 }
 
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Headless simulation of spaceTravel.cpp for load testing the game logic.
+//
+// Creates the asteroid field and drives the car from a scripted input stream with no
+// window or OpenGL context, restarting immediately after each crash or finish, and
+// reports the number of simulation steps per second and the time taken by restarts.
+//
+// Usage: spaceTravelHeadless [--steps N] [--rows N] [--seed N] [--script FILE] [--keep-field]
+//                            [--endless]
+//
+// A script is a sequence of the letters L, R, U and D (left, right, up and down arrow
+// key presses); anything else is ignored. It is replayed from the start when it runs
+// out. Without a script the car drives forward, weaving left and right.
+// --keep-field restarts on the same field instead of generating a new one, to time
+// the car logic alone on large fields. --endless streams the track in chunks instead of
+// generating --rows rows, and reports how far the car got.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "spaceTravelSim.h"
+
+// Default input: forward with a gentle weave.
+static const char *defaultScript = "UUUUUUUUUULUUUUUUUUUUUUUUUURUUUUUUUUUURUUUUUUUUUUUUUUUULUUUUUUUUUU";
+
+// Function to turn script text into car inputs.
+static std::vector<CarInput> parseScript(const std::string &text)
+{
+    std::vector<CarInput> inputs;
+
+    for (size_t k = 0; k < text.size(); k++)
+        switch (text[k])
+        {
+            case 'L': case 'l': inputs.push_back(CAR_TURN_LEFT); break;
+            case 'R': case 'r': inputs.push_back(CAR_TURN_RIGHT); break;
+            case 'U': case 'u': inputs.push_back(CAR_FORWARD); break;
+            case 'D': case 'd': inputs.push_back(CAR_BACKWARD); break;
+            default: break;
+        }
+    return inputs;
+}
+
+// Main routine.
+int main(int argc, char **argv)
+{
+    long long steps = 10000000;
+    std::string script = defaultScript;
+    bool keepField = false;
+
+    for (int k = 1; k < argc; k++)
+    {
+        if (!strcmp(argv[k], "--steps") && k + 1 < argc) steps = atoll(argv[++k]);
+        else if (!strcmp(argv[k], "--rows") && k + 1 < argc) trackRows = atoi(argv[++k]);
+        else if (!strcmp(argv[k], "--seed") && k + 1 < argc) levelSeed = atoi(argv[++k]);
+        else if (!strcmp(argv[k], "--keep-field")) keepField = true;
+        else if (!strcmp(argv[k], "--endless")) endlessMode = 1;
+        else if (!strcmp(argv[k], "--script") && k + 1 < argc)
+        {
+            std::ifstream file(argv[++k]);
+            if (!file)
+            {
+                std::cerr << "Cannot open script " << argv[k] << std::endl;
+                return 1;
+            }
+            script.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--steps N] [--rows N] [--seed N] [--script FILE] [--keep-field] [--endless]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<CarInput> inputs = parseScript(script);
+    if (inputs.empty())
+    {
+        std::cerr << "Script has no L/R/U/D inputs" << std::endl;
+        return 1;
+    }
+
+    std::chrono::steady_clock::time_point generateStart = std::chrono::steady_clock::now();
+    generateAsteroids();
+    std::cout << "Generated " << asteroidField.getCount() << " asteroids in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - generateStart).count()
+              << " ms" << std::endl;
+    resetCar();
+
+    long long crashes = 0, finishes = 0;
+    float furthestZ = zVal;
+    double restartSeconds = 0.0;
+    size_t next = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long long step = 0; step < steps; step++)
+    {
+        int blocked = moveCar(inputs[next]);
+        if (zVal < furthestZ) furthestZ = zVal;
+        if (++next == inputs.size()) next = 0;
+
+        // Restart right away instead of after the game's 3 second pause.
+        if (blocked || crossedFinishLine())
+        {
+            if (blocked) crashes++;
+            else finishes++;
+            std::chrono::steady_clock::time_point restartStart = std::chrono::steady_clock::now();
+            if (!keepField)
+            {
+                levelSeed++;
+                generateAsteroids();
+            }
+            resetCar();
+            restartSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - restartStart).count();
+            next = 0;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << steps << " steps in " << seconds << " s: " << steps / seconds << " steps/s" << std::endl
+              << trackRows << " rows, " << asteroidField.getCount() << " asteroids in the last field" << std::endl
+              << crashes << " crashes, " << finishes << " finishes" << std::endl;
+    if (endlessMode)
+        std::cout << "Furthest the car got: z = " << furthestZ << std::endl;
+    if (crashes + finishes > 0)
+        std::cout << "Mean restart " << 1e6 * restartSeconds / (crashes + finishes) << " us" << std::endl;
+    return 0;
+}
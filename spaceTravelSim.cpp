@@ -0,0 +1,302 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Game logic of spaceTravel.cpp. See spaceTravelSim.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+
+#include <cstdlib>
+#include <cmath>
+
+#include "counterRng.h"
+#include "poissonDisk.h"
+#include "profiler.h"
+#include "spaceTravelSim.h"
+#include "sphereIntersection.h"
+
+// Globals.
+float angle = 0.0; // Angle of the car.
+float xVal = 0, zVal = 120; // Co-ordinates of the car.
+int isCollision = 0; // Is there collision between the car and an asteroid?
+int trackRows = ROWS; // Number of asteroid rows generated.
+AsteroidField asteroidField; // Live asteroids.
+AsteroidGrid asteroidGrid; // Broadphase over asteroidField, built in generateAsteroids().
+int fieldVersion = 0; // Bumped every time asteroidField changes.
+unsigned int levelSeed = 1; // Seed of the field; the same seed always gives the same field.
+int endlessMode = 0; // Stream the track in chunks around the car instead of trackRows rows.
+static PoissonDiskGrid placementGrid; // Asteroids placed so far, for spacing new ones.
+static AsteroidField chunkFields[STREAM_CHUNKS]; // Ring of streamed chunks, chunk c in slot c % STREAM_CHUNKS.
+static int chunkIndex[STREAM_CHUNKS]; // Chunk held by each slot, -1 if none; set by generateAsteroids().
+
+// Chunks are placed on their own, so an asteroid must not be able to crowd one in the
+// next row.
+static_assert(ROW_SPACING >= MIN_ASTEROID_SPACING, "rows closer than the asteroid spacing");
+
+// Function to check if two spheres centered at (x1,y1,z1) and (x2,y2,z2) with
+// radius r1 and r2 intersect.
+int checkSpheresIntersection(float x1, float y1, float z1, float r1,
+                             float x2, float y2, float z2, float r2)
+{
+    return ((x1 - x2)*(x1 - x2) + (y1 - y2)*(y1 - y2) + (z1 - z2)*(z1 - z2) <= (r1 + r2)*(r1 + r2));
+}
+
+int CarCraftCollision(float x, float z, float a)
+{
+    PROFILE_FUNCTION();
+
+    // Probe sphere in front of the car.
+    float probeX = x - 5 * sin((M_PI / 180.0) * a);
+    float probeZ = z - 5 * cos((M_PI / 180.0) * a);
+
+    // Test the probe against each run of asteroids the grid says it can reach.
+    const float *centerX = asteroidField.getCenterX(), *centerY = asteroidField.getCenterY();
+    const float *centerZ = asteroidField.getCenterZ(), *radius = asteroidField.getRadius();
+    return asteroidGrid.queryRanges(probeX, probeZ, 1.5, [&](int begin, int end)
+    {
+        return checkSpheresIntersectionBatch(probeX, 0.0, probeZ, 1.5, centerX + begin, centerY + begin,
+                                             centerZ + begin, radius + begin, end - begin) >= 0;
+    });
+}
+
+// Function to find the first contact between an asteroid and the car's probe sphere
+// as the car moves from (x0,z0) with heading a0 to (x1,z1) with heading a1.
+// Returns the fraction of the move done at contact, or a value above 1 if there is none.
+float CarCraftTimeOfImpact(float x0, float z0, float a0, float x1, float z1, float a1)
+{
+    PROFILE_FUNCTION();
+
+    // The probe moves along the segment between its start and end positions.
+    float probeX = x0 - 5 * sin((M_PI / 180.0) * a0);
+    float probeZ = z0 - 5 * cos((M_PI / 180.0) * a0);
+    float moveX = x1 - 5 * sin((M_PI / 180.0) * a1) - probeX;
+    float moveZ = z1 - 5 * cos((M_PI / 180.0) * a1) - probeZ;
+
+    // Query the grid with a sphere around the whole segment.
+    float halfLength = 0.5 * sqrt(moveX * moveX + moveZ * moveZ);
+    const float *centerX = asteroidField.getCenterX(), *centerY = asteroidField.getCenterY();
+    const float *centerZ = asteroidField.getCenterZ(), *radius = asteroidField.getRadius();
+    float first = 2.0;
+    asteroidGrid.queryRanges(probeX + 0.5 * moveX, probeZ + 0.5 * moveZ, 1.5 + halfLength,
+                             [&](int begin, int end)
+    {
+        float t = sweptSphereTimeOfImpact(probeX, 0.0, probeZ, 1.5, moveX, 0.0, moveZ,
+                                          centerX + begin, centerY + begin, centerZ + begin,
+                                          radius + begin, end - begin);
+        if (t < first) first = t;
+        return first == 0.0; // Nothing can come earlier than an overlap at the start.
+    });
+    return first;
+}
+
+// Function to check if the car is off the track.
+int isOffTrack(float x, float angle)
+{
+    // Declare the track boundaries.
+    float trackLeftBoundary;
+    float trackRightBoundary;
+
+    // Check if the car's x-coordinate is outside the track boundaries.
+    if (angle<=30 && angle>= -30){
+        trackLeftBoundary = -40.0-SIZE;
+        trackRightBoundary = 40.0+SIZE;
+    }else{
+        trackLeftBoundary = -40.0;
+        trackRightBoundary = 40.0;
+    }
+
+    // Check if the car's x-coordinate is outside the track boundaries.
+    if (x < trackLeftBoundary || x > trackRightBoundary)
+    {
+        return 1;
+    }
+
+    return  0;
+}
+
+// Function to check if two cubes intersect.
+int checkCubesIntersection(float x1, float y1, float z1, float s1,
+                           float x2, float y2, float z2, float s2)
+{
+    return (abs(x1 - x2) * 2 < (s1 + s2)) &&
+           (abs(y1 - y2) * 2 < (s1 + s2)) &&
+           (abs(z1 - z2) * 2 < (s1 + s2));
+}
+
+// Function to append rows firstRow to firstRow + rows - 1 to field. Each filled slot
+// throws darts until one lands far enough from every asteroid placed so far.
+static void generateRows(AsteroidField &field, int firstRow, int rows)
+{
+    int i, j, attempt;
+
+    field.reserve(field.getCount() + rows * COLUMNS);
+    placementGrid.reset(-30.0, 80.0 - ROW_SPACING * (firstRow + rows - 1), 30.0, 80.0 - ROW_SPACING * firstRow,
+                        MIN_ASTEROID_SPACING);
+    for (i = firstRow; i<firstRow + rows; i++)
+    {
+        // Each row draws from its own stream, so it does not depend on the other rows.
+        CounterRng rng(levelSeed, i);
+
+        for (j = 0; j<COLUMNS; j++)
+        {
+            if (rng.nextInt(100) < FILL_PROBABILITY)
+            {
+                for (attempt = 0; attempt < PLACEMENT_ATTEMPTS; attempt++)
+                {
+                    // Generate random positions for the new asteroid.
+                    float x = rng.nextInt(60) - 30;
+                    float y = -2.0;
+                    float z = 80.0 - ROW_SPACING*i;
+
+                    if (placementGrid.fits(x, z))
+                    {
+                        placementGrid.insert(x, z);
+                        field.add(x, y, z, SIZE, rng.nextInt(256), rng.nextInt(256), rng.nextInt(256));
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Function to generate the chunks first to first + STREAM_CHUNKS - 1 that are not in
+// the ring yet, each in the slot of the chunk it replaces. Returns 1 if any was generated.
+static int streamChunks(int first)
+{
+    int changed = 0;
+
+    for (int c = first; c < first + STREAM_CHUNKS; c++)
+    {
+        int slot = c % STREAM_CHUNKS;
+        if (chunkIndex[slot] == c) continue;
+
+        chunkFields[slot].clear();
+        generateRows(chunkFields[slot], c * CHUNK_ROWS, CHUNK_ROWS);
+        chunkIndex[slot] = c;
+        changed = 1;
+    }
+    if (!changed) return 0;
+
+    // Gather the ring into the live field.
+    asteroidField.clear();
+    asteroidField.reserve(STREAM_CHUNKS * CHUNK_ROWS * COLUMNS);
+    for (int slot = 0; slot < STREAM_CHUNKS; slot++)
+    {
+        const AsteroidField &chunk = chunkFields[slot];
+        const unsigned char *color = chunk.getColor();
+        for (int k = 0; k < chunk.getCount(); k++)
+            asteroidField.add(chunk.getCenterX()[k], chunk.getCenterY()[k], chunk.getCenterZ()[k],
+                              chunk.getRadius()[k], color[4 * k], color[4 * k + 1], color[4 * k + 2]);
+    }
+    return 1;
+}
+
+// Function to generate the level's asteroid field.
+void generateAsteroids(void)
+{
+    PROFILE_FUNCTION();
+
+    if (endlessMode)
+    {
+        // Start again from the first chunks.
+        for (int slot = 0; slot < STREAM_CHUNKS; slot++) chunkIndex[slot] = -1;
+        streamChunks(0);
+    }
+    else
+    {
+        asteroidField.clear();
+        generateRows(asteroidField, 0, trackRows);
+    }
+
+    // Cells as wide as an asteroid, so a probe only reaches the neighbouring cells.
+    asteroidGrid.build(asteroidField, 2.0 * SIZE);
+    fieldVersion++;
+}
+
+// Function to recycle the chunks the car has left behind.
+int streamAsteroids(void)
+{
+    if (!endlessMode) return 0;
+
+    // Keep one chunk behind the car, so asteroids it has just passed still collide.
+    int carChunk = (int)floor((80.0 - zVal) / (ROW_SPACING * CHUNK_ROWS));
+    int first = carChunk > 0 ? carChunk - 1 : 0;
+    if (!streamChunks(first)) return 0;
+
+    asteroidGrid.build(asteroidField, 2.0 * SIZE);
+    fieldVersion++;
+    return 1;
+}
+
+// Function to get the chunk held in a ring slot.
+int getStreamChunk(int slot)
+{
+    return chunkIndex[slot];
+}
+
+// Function to get where chunk c starts along z, half a row before its first row.
+float getChunkStartZ(int c)
+{
+    return 80.0 + 0.5 * ROW_SPACING - ROW_SPACING * CHUNK_ROWS * c;
+}
+
+// Function to put the car back on the start line.
+void resetCar(void)
+{
+    xVal = 0;
+    zVal = 120;
+    angle = 0.0;
+    isCollision = 0;
+}
+
+// Function to move the car one step.
+int moveCar(CarInput input)
+{
+    float tempxVal = xVal, tempzVal = zVal, tempAngle = angle;
+
+    // Compute next position.
+    if (input == CAR_TURN_LEFT) tempAngle = angle + 5.0;
+    if (input == CAR_TURN_RIGHT) tempAngle = angle - 5.0;
+    if (input == CAR_FORWARD)
+    {
+        tempxVal = xVal - CAR_STEP * sin(tempAngle * M_PI / 180.0);
+        tempzVal = zVal - CAR_STEP * cos(tempAngle * M_PI / 180.0);
+    }
+    if (input == CAR_BACKWARD)
+    {
+        tempxVal = xVal + CAR_STEP * sin(tempAngle * M_PI / 180.0);
+        tempzVal = zVal + CAR_STEP * cos(tempAngle * M_PI / 180.0);
+    }
+
+    // Angle correction.
+    if (tempAngle > 360.0) tempAngle -= 360.0;
+    if (tempAngle < 0.0) tempAngle += 360.0;
+
+    // First contact with an asteroid anywhere along the move.
+    float impact = CarCraftTimeOfImpact(xVal, zVal, angle, tempxVal, tempzVal, tempAngle);
+
+    // Move car to next position only if there will not be collision with an asteroid or off the track.
+    if (impact > 1.0 && !isOffTrack(tempxVal, angle))
+    {
+        isCollision = 0;
+        xVal = tempxVal;
+        zVal = tempzVal;
+        angle = tempAngle;
+        streamAsteroids();
+        return 0;
+    }
+
+    // Stop the car where it touched the asteroid.
+    if (impact <= 1.0)
+    {
+        xVal += impact * (tempxVal - xVal);
+        zVal += impact * (tempzVal - zVal);
+    }
+    isCollision = 1;
+    return 1;
+}
+
+// Function to check if the car has crossed the finish line.
+int crossedFinishLine(void)
+{
+    return !endlessMode && zVal <= -ROW_SPACING * trackRows;
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Game logic of spaceTravel.cpp: the asteroid field, the car and its collision
+// detection. Nothing here needs a window or an OpenGL context, so the same logic
+// drives both the GLUT game and the headless simulation (spaceTravelHeadless.cpp).
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPACE_TRAVEL_SIM_H
+#define SPACE_TRAVEL_SIM_H
+
+#include "asteroidField.h"
+#include "asteroidGrid.h"
+
+#define ROWS 10  // Number of rows of asteroids.
+#define COLUMNS 5 // Number of columns of asteroids.
+#define FILL_PROBABILITY 50 // Percentage probability that a particular row-column slot will be
+                             // filled with an asteroid. It should be an integer between 0 and 100.
+
+#define SIZE 10 // Size of each obstacle.
+#define ROW_SPACING 30.0 // Distance along z between rows of asteroids; row i is at z = 80 - ROW_SPACING * i.
+#define CHUNK_ROWS 8 // Rows of asteroids generated at a time in endless mode.
+#define STREAM_CHUNKS 6 // Chunks kept in endless mode: the one behind the car, its own and those ahead.
+#define MIN_ASTEROID_SPACING (2.0 * SIZE) // Smallest distance between two asteroid centers, so
+                                          // their collision spheres never overlap.
+#define PLACEMENT_ATTEMPTS 6 // Darts thrown for a slot before it is left empty.
+#define CAR_STEP 1.0 // Distance the car moves per up/down key press. Collision is swept,
+                     // so larger steps do not let the car tunnel through asteroids.
+
+// One step of car input, the arrow keys of the game.
+enum CarInput
+{
+    CAR_TURN_LEFT,
+    CAR_TURN_RIGHT,
+    CAR_FORWARD,
+    CAR_BACKWARD
+};
+
+// Game state.
+extern float angle; // Angle of the car.
+extern float xVal, zVal; // Co-ordinates of the car.
+extern int isCollision; // Is there collision between the car and an asteroid?
+extern int trackRows; // Number of asteroid rows generated, ROWS unless changed before setup.
+extern AsteroidField asteroidField; // Live asteroids.
+extern AsteroidGrid asteroidGrid; // Broadphase over asteroidField.
+extern int fieldVersion; // Bumped every time asteroidField changes.
+extern unsigned int levelSeed; // Seed of the field; the same seed always gives the same field.
+extern int endlessMode; // Stream the track in chunks around the car instead of trackRows rows.
+
+// Function to check if two spheres centered at (x1,y1,z1) and (x2,y2,z2) with
+// radius r1 and r2 intersect.
+int checkSpheresIntersection(float x1, float y1, float z1, float r1,
+                             float x2, float y2, float z2, float r2);
+
+// Function to check if the car at (x,z) with heading a touches an asteroid.
+int CarCraftCollision(float x, float z, float a);
+
+// Function to find the first contact between an asteroid and the car's probe sphere
+// as the car moves from (x0,z0) with heading a0 to (x1,z1) with heading a1.
+// Returns the fraction of the move done at contact, or a value above 1 if there is none.
+float CarCraftTimeOfImpact(float x0, float z0, float a0, float x1, float z1, float a1);
+
+// Function to check if the car is off the track.
+int isOffTrack(float x, float angle);
+
+// Function to check if two cubes intersect.
+int checkCubesIntersection(float x1, float y1, float z1, float s1,
+                           float x2, float y2, float z2, float s2);
+
+// Function to fill the asteroid field with trackRows random rows from levelSeed and build
+// its grid. Asteroids are kept at least MIN_ASTEROID_SPACING apart. In endless mode only
+// the first STREAM_CHUNKS chunks are generated.
+void generateAsteroids(void);
+
+// Function to keep the chunks around the car generated in endless mode. Chunks left
+// behind are recycled for new ones ahead, so the field never holds more than
+// STREAM_CHUNKS chunks. Returns 1 if the field changed.
+int streamAsteroids(void);
+
+// Function to get the chunk held in ring slot slot, or -1 if the slot is empty.
+int getStreamChunk(int slot);
+
+// Function to get the z of the edge of chunk c nearest to the start line; the chunk
+// extends CHUNK_ROWS * ROW_SPACING beyond it.
+float getChunkStartZ(int c);
+
+// Function to put the car back on the start line.
+void resetCar(void);
+
+// Function to apply one step of input to the car. Returns 1 if the move was blocked by
+// an asteroid or the track edge, in which case isCollision is set. In endless mode the
+// asteroid chunks are streamed after each move.
+int moveCar(CarInput input);
+
+// Function to check if the car has crossed the finish line. Never true in endless mode.
+int crossedFinishLine(void);
+
+#endif
@@ -29,25 +29,47 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <gl/glut.h>
+#include <glew.h>
+#include <GL/glut.h>
 #include <math.h>
 #include<string.h>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "counterRng.h"
+#include "frameStats.h"
+#include "highScoreStore.h"
+#include "profiler.h"
+#include "simClock.h"
+#include "shaderProgram.h"
+#include "solidShapes.h"
+#include "sphereCache.h"
+#include "textRenderer.h"
+#ifdef OFFSCREEN_RENDERING
+#include "goldenImage.h"
+#include "offscreenContext.h"
+#endif
 
 #define PI 3.14159
 #define GAME_SCREEN 0			//Constant to identify background color
 #define MENU_SCREEN 4			
-#define MAX_STONES  100      
+#ifndef MAX_STONES
+#define MAX_STONES  100			//stones per wave; drawing stays cheap into the hundreds of thousands
+#endif
 #define MAX_STONE_TYPES 5
-#define stoneRotationSpeed 20
-#define SPACESHIP_SPEED 20
-int stoneTranslationSpeed=5;
+#define stoneRotationSpeed 20			//degrees per simulation step
+#define SPACESHIP_STEP 20				//units a tapped move key moves the ship, as one key event did
+#define SPACESHIP_SPEED 600				//units per second while a move key stays held, as 20-unit key repeats at 30 Hz did
+#define SIM_RATE 60						//simulation steps per second, whatever the frame rate
+#define FRAME_RATE 60					//most frames per second; the game screen is redrawn at this rate, other screens when something changes
+#define GOLDEN_CHECKS 4					//evenly spaced frames of an offscreen run checked against golden images
+int stoneTranslationSpeed=5;			//units per simulation step
 
 GLint m_viewport[4];
 GLint CI=0;
 int x,y;
 int i;
-int randomStoneIndices[100];
-int index;
+int randomStoneIndices[MAX_STONES];
 int Score=0;
 int alienLife=100;
 int GameLvl= 1;
@@ -57,10 +79,17 @@ float xOne=0,yOne=0;				//Spaceship coordinates
 float xStone[MAX_STONES] ,yStone[MAX_STONES];//coordinates of stones
 float xStart = 1200;				//Health bar starting coodinate
 GLint stoneAlive[MAX_STONES];		//check to see if stone is killed
+unsigned int stoneSeed = 1;			//Seed of the stone waves, the same seed replays the same waves
+unsigned int stoneWave = 0;			//Number of waves generated so far
 
 bool mButtonPressed= false,startGame=false,gameOver=false;		//boolean values to check state of the game
 bool startScreen = true ,nextScreen=false,previousScreen=false;
 bool gameQuit = false,instructionsGame = false, optionsGame = false;
+SimClock simClock(SIM_RATE);			//paces the simulation steps run by display()
+const char moveKeys[] = "wasd";			//up, left, down, right
+bool moveKeyDown[4] ,moveKeyPressed[4];	//move keys held, and pressed since the last simulation step
+bool mButtonReleased = false;		//left button released since the last frame; the press is kept until a frame has seen it
+bool offscreen = false;				//drawing into an offscreen framebuffer with no GLUT window (--offscreen)
 
 GLfloat a[][2]={0,-50, 70,-50, 70,70, -70,70};
 GLfloat LightColor[][3]={1,1,0,   0,1,1,   0,1,0};
@@ -76,17 +105,13 @@ GLfloat ALienFace[][2]={{-6,11}, {-4.5,18}, {0.5,20}, {0.,20.5}, {0.1,19.5}, {1.
 GLfloat ALienBeak[][2]={{-6,21.5}, {-6.5,22}, {-9,21}, {-11,20.5}, {-20,20}, {-14,23}, {-9.5,28}, {-7,27}, {-6,26.5}, 
 						{-4.5,23}, {-4,21}, {-6,19.5}, {-8.5,19}, {-10,19.5}, {-11,20.5} };
 
-char highScore[100],ch;
+HighScoreStore highScores("HighScores.bin");	//loaded once at startup, saved in the background
 void display();
+void requestRedraw();
+void simulationStep();
 void StoneGenerate();
-void displayRasterText(float x ,float y ,float z ,char *stringToDisplay) {
-	int length;
-	glRasterPos3f(x, y, z);
-		length = strlen(stringToDisplay);
-
-	for(int i=0 ;i<length ;i++){
-		glutBitmapCharacter(GLUT_BITMAP_TIMES_ROMAN_24 ,stringToDisplay[i]); 
-	}
+void displayRasterText(float x ,float y ,float z ,const char *stringToDisplay) {
+	drawText(TEXT_TIMES_ROMAN_24 ,x ,y ,z ,stringToDisplay);	//queued, drawn by flushText at the end of display
 }
 void SetDisplayMode(int modeToDisplay) {
 		switch(modeToDisplay){
@@ -95,20 +120,20 @@ void SetDisplayMode(int modeToDisplay) {
 	}
 }
 void initializeStoneArray() {
-	//random stones index
-	
-	for(int i = 0;i < MAX_STONES ;i++) {
-		randomStoneIndices[i]=rand()%MAX_STONE_TYPES;
-		stoneAlive[i]=true;
-	}
+	//each stone of each wave has its own random stream
+	uint64_t wave = (uint64_t)stoneWave++ << 32;
 
 	xStone[0] = -(200*MAX_STONES)-600;             //START LINE for stone appearance
 												
-	for(int i = 0;i<MAX_STONES ;i++) {				//ramdom appearance yIndex for each stone
-		yStone[i]=rand()%600;
+	for(int i = 0;i<MAX_STONES ;i++) {				//ramdom type and appearance yIndex for each stone
+		CounterRng rng(stoneSeed, wave | i);
+		randomStoneIndices[i]=rng.nextInt(MAX_STONE_TYPES);
+		stoneAlive[i]=true;
+		yStone[i]=rng.nextInt(600);
 		if(int(yStone[i])%2)
 			yStone[i]*=-1;
-		xStone[i+1] = xStone[i] + 200;				//xIndex of stone aligned with 200 units gap
+		if(i+1 < MAX_STONES)
+			xStone[i+1] = xStone[i] + 200;			//xIndex of stone aligned with 200 units gap
 	}
 }
 void DrawAlienBody()
@@ -190,15 +215,13 @@ void DrawAlienEyes()
 	glPushMatrix();
 	glRotated(-10,0,0,1);
 	glTranslated(-6,32.5,0);      //Left eye
-	glScalef(2.5,4,0);
-	glutSolidSphere(1,20,30);
+	drawCachedSphere(2.5,4,0,20,30);
 	glPopMatrix();
 
 	glPushMatrix();	
 	glRotated(-1,0,0,1);
 	glTranslated(-8,36,0);							//Right eye	
-	glScalef(2.5,4,0);
-	glutSolidSphere(1,100,100);
+	drawCachedSphere(2.5,4,0,100,100);
 	glPopMatrix();
 }
 void DrawAlien()
@@ -213,40 +236,36 @@ void DrawSpaceshipBody()
 {
 	glColor3f(1,0,0);				//BASE
 
-	glPushMatrix();				
-	glScalef(70,20,1);
-	glutSolidSphere(1,50,50);
-	glPopMatrix(); 
+	drawCachedSphere(70,20,1,50,50);
 			
-	glPushMatrix();							//LIGHTS
-	glScalef(3,3,1);
-	glTranslated(-20,0,0);			//1
+	glPushMatrix();							//LIGHTS, 15 apart
+	glTranslated(-60,0,0);			//1
 	glColor3fv(LightColor[(CI+0)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//2
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//2
 	glColor3fv(LightColor[(CI+1)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//3
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//3
 	glColor3fv(LightColor[(CI+2)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//4				
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//4				
 	glColor3fv(LightColor[(CI+0)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//5
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//5
 	glColor3fv(LightColor[(CI+1)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//6			
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//6			
 	glColor3fv(LightColor[(CI+2)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//7
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//7
 	glColor3fv(LightColor[(CI+0)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//8				
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//8				
 	glColor3fv(LightColor[(CI+1)%3]);
-	glutSolidSphere(1,1000,1000);
-	glTranslated(5,0,0);					//9
+	drawCachedSphere(3,3,1,1000,1000);
+	glTranslated(15,0,0);					//9
 	glColor3fv(LightColor[(CI+2)%3]);
-	glutSolidSphere(1,1000,1000);
+	drawCachedSphere(3,3,1,1000,1000);
 			
 	glPopMatrix();
 }
@@ -257,7 +276,7 @@ void DrawSteeringWheel()
 	glColor3f(0.20,0.,0.20);
 	glScalef(7,4,1);
 	glTranslated(-1.9,5.5,0);
-	glutWireSphere(1,8,8);	
+	drawWireSphere(1,8,8);	
 	glPopMatrix();
 	
 }
@@ -266,8 +285,7 @@ void DrawSpaceshipDoom()
 	glColor4f(0.7,1,1,0.0011);
 	glPushMatrix();
 	glTranslated(0,30,0);
-	glScalef(35,50,1);
-	glutSolidSphere(1,50,50);
+	drawCachedSphere(35,50,1,50,50);
 	glPopMatrix();
 }
 void DrawSpaceShipLazer() {
@@ -319,110 +337,134 @@ void DrawLazerBeam() {
 	glEnd();
 	glLineWidth(1);
 }
-void DrawStone(int StoneIndex)
-{
-	glPushMatrix();
-	glLoadIdentity();
-	switch(StoneIndex)                           //CHANGE INDEX VALUE FOR DIFFERENT STONE VARIETY;
-	{
-	case 0:
-
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glColor3f(0.4f, 0.0f, 0.0f);
-		glScalef(35,35,1);
-		glutSolidSphere(1,9,50);
-		
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(60,10,1);
-		glutSolidSphere(1,5,50);
-		
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(10,60,1);
-		glutSolidSphere(1,5,50);
-		break;
-
-	case 1:
-		glColor3f(1.0f, 0.8f, 0.8f);
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(15,20,1);
-		glutSolidSphere(1,9,50);
-
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(40,5,1);
-		glutSolidSphere(1,5,50);
-		break;
-
-	case 2:
-		glColor3f(0.2f, 0.2f, 0.0f);
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(60,25,1);
-		glutSolidSphere(1,9,50);
-
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(25,60,1);
-		glutSolidSphere(1,9,50);
-		
-		break;
-
-	case 3:
-		glColor3f(0.8f, 0.8f, 0.1f);
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(35,10,1);
-		glutSolidSphere(1,10,7);
-
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(50,20,1);
-		glutSolidSphere(1,5,50);
-		break;
-	case 4:
-		glColor3f(0.26f, 0.26f, 0.26f);
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(10,55,1);
-		glutSolidSphere(1,9,50);
-
-		glLoadIdentity();
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(20,10,1);
-		glutSolidSphere(1,9,50);
-		glLoadIdentity();
-
-		glTranslated(xStone[index] , yStone[index] ,0);
-		glRotatef(stoneAngle+45 ,0, 0, 1);
-		glTranslated(0, 0, 0);
-		glScalef(25,10,1);
-		glutSolidSphere(1,9,50);
-		break;
+struct StonePart {					//one scaled sphere of a stone, turned by angle about the stone center
+	float scaleX ,scaleY ,angle;
+	int slices ,stacks;
+};
+struct StoneType {
+	float color[3];
+	int partCount;
+	StonePart parts[3];
+};
+const StoneType stoneTypes[MAX_STONE_TYPES]={	//CHANGE FOR DIFFERENT STONE VARIETY
+	{{0.4f, 0.0f, 0.0f} ,3 ,{{35,35,0,9,50}, {60,10,0,5,50}, {10,60,0,5,50}}},
+	{{1.0f, 0.8f, 0.8f} ,2 ,{{15,20,0,9,50}, {40,5,0,5,50}}},
+	{{0.2f, 0.2f, 0.0f} ,2 ,{{60,25,0,9,50}, {25,60,0,9,50}}},
+	{{0.8f, 0.8f, 0.1f} ,2 ,{{35,10,0,10,7}, {50,20,0,5,50}}},
+	{{0.26f, 0.26f, 0.26f} ,3 ,{{10,55,0,9,50}, {20,10,0,9,50}, {25,10,45,9,50}}} };
+#define STONE_REACH 60					//no stone reaches further than this from its center
+
+struct StoneInstance {					//per-stone data of the instanced draw
+	float x ,y ,angle;
+};
+GLuint stoneProgram ,stoneVao[MAX_STONE_TYPES] ,stoneMeshVbo[MAX_STONE_TYPES] ,stoneMeshIbo[MAX_STONE_TYPES];
+GLuint stoneInstanceVbo;
+int stoneIndexCount[MAX_STONE_TYPES];
+int stoneInstanceCapacity = 0;			//stones stoneInstanceVbo has room for
+GLint stoneColorLocation;
+std::vector<StoneInstance> stoneInstances[MAX_STONE_TYPES];	//stones of each type to draw this frame
+
+const char *stoneVertexShader =			//places a baked stone at each instance, turned by its angle
+	"#version 150 compatibility\n"
+	"in vec3 position;\n"
+	"in vec3 instance;\n"
+	"void main()\n"
+	"{\n"
+	"    float a = radians(instance.z);\n"
+	"    vec2 turned = vec2(cos(a) * position.x - sin(a) * position.y, sin(a) * position.x + cos(a) * position.y);\n"
+	"    gl_Position = gl_ProjectionMatrix * vec4(instance.xy + turned, position.z, 1.0);\n"
+	"}\n";
+const char *stoneFragmentShader =
+	"#version 150 compatibility\n"
+	"uniform vec4 stoneColor;\n"
+	"void main()\n"
+	"{\n"
+	"    gl_FragColor = stoneColor;\n"
+	"}\n";
+
+void buildStoneMeshes() {				//bake the spheres of each stone type into one mesh, tessellated like drawCachedSphere would
+	static const char *attributes[] = { "position", "instance", NULL };
+	stoneProgram = buildShaderProgram(stoneVertexShader ,stoneFragmentShader ,attributes);
+	stoneColorLocation = glGetUniformLocation(stoneProgram ,"stoneColor");
+	glGenBuffers(1 ,&stoneInstanceVbo);
+
+	for(int t=0 ;t<MAX_STONE_TYPES ;t++) {
+		std::vector<float> vertices;
+		std::vector<unsigned int> indices;
+		for(int p=0 ;p<stoneTypes[t].partCount ;p++) {
+			const StonePart &part = stoneTypes[t].parts[p];
+			int slices = part.slices ,stacks = part.stacks;
+			capSphereDetail(part.scaleX > part.scaleY ? part.scaleX : part.scaleY ,slices ,stacks);	//sized by its longest axis
+
+			ShapeMesh sphere;
+			generateSolidSphere(1 ,slices ,stacks ,sphere);
+			float c = cos(part.angle*PI/180) ,s = sin(part.angle*PI/180);
+			unsigned int base = vertices.size()/3;
+			for(size_t k=0 ;k<sphere.vertices.size() ;k+=3) {
+				float x = sphere.vertices[k]*part.scaleX ,y = sphere.vertices[k+1]*part.scaleY;
+				vertices.push_back(c*x - s*y);
+				vertices.push_back(s*x + c*y);
+				vertices.push_back(sphere.vertices[k+2]);
+			}
+			for(size_t k=0 ;k<sphere.indices.size() ;k++)
+				indices.push_back(base + sphere.indices[k]);
+		}
+
+		glGenVertexArrays(1 ,&stoneVao[t]);
+		glGenBuffers(1 ,&stoneMeshVbo[t]);
+		glGenBuffers(1 ,&stoneMeshIbo[t]);
+		glBindVertexArray(stoneVao[t]);
+		glBindBuffer(GL_ARRAY_BUFFER ,stoneMeshVbo[t]);
+		glBufferData(GL_ARRAY_BUFFER ,vertices.size()*sizeof(float) ,vertices.data() ,GL_STATIC_DRAW);
+		glEnableVertexAttribArray(0);
+		glVertexAttribPointer(0 ,3 ,GL_FLOAT ,GL_FALSE ,0 ,0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER ,stoneMeshIbo[t]);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER ,indices.size()*sizeof(unsigned int) ,indices.data() ,GL_STATIC_DRAW);
+		glEnableVertexAttribArray(1);	//instances come from stoneInstanceVbo, pointed at in drawStones
+		glVertexAttribDivisor(1 ,1);
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER ,0);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER ,0);
+		stoneIndexCount[t] = indices.size();
 	}
-	glPopMatrix();
+}
+void drawStones() {					//stream the stones queued by StoneGenerate and draw each type with one instanced call
+	PROFILE_FUNCTION();
+	int count = 0;
+	for(int t=0 ;t<MAX_STONE_TYPES ;t++)
+		count += stoneInstances[t].size();
+	if(!count)
+		return;
+
+	glBindBuffer(GL_ARRAY_BUFFER ,stoneInstanceVbo);
+	if(count > stoneInstanceCapacity)
+		stoneInstanceCapacity = count;
+	glBufferData(GL_ARRAY_BUFFER ,stoneInstanceCapacity*sizeof(StoneInstance) ,NULL ,GL_STREAM_DRAW);	//orphan last frame's stones
+	int first = 0;
+	for(int t=0 ;t<MAX_STONE_TYPES ;t++) {
+		glBufferSubData(GL_ARRAY_BUFFER ,first*sizeof(StoneInstance) ,stoneInstances[t].size()*sizeof(StoneInstance) ,stoneInstances[t].data());
+		first += stoneInstances[t].size();
+	}
+
+	glUseProgram(stoneProgram);
+	first = 0;
+	for(int t=0 ;t<MAX_STONE_TYPES ;t++) {
+		int n = stoneInstances[t].size();
+		if(n) {
+			glBindVertexArray(stoneVao[t]);
+			glVertexAttribPointer(1 ,3 ,GL_FLOAT ,GL_FALSE ,sizeof(StoneInstance) ,(void *)(first*sizeof(StoneInstance)));
+			glUniform4f(stoneColorLocation ,stoneTypes[t].color[0] ,stoneTypes[t].color[1] ,stoneTypes[t].color[2] ,1);
+			glDrawElementsInstanced(GL_TRIANGLES ,stoneIndexCount[t] ,GL_UNSIGNED_INT ,0 ,n);
+		}
+		first += n;
+		stoneInstances[t].clear();
+	}
+	glBindVertexArray(0);
+	glUseProgram(0);
+	glBindBuffer(GL_ARRAY_BUFFER ,0);
 }
 bool checkIfSpaceShipIsSafe() {
+	PROFILE_FUNCTION();
 		for(int i =0 ;i<MAX_STONES ;i++) {
 		if(stoneAlive[i]&((xOne >= (xStone[i]/2 -70) && xOne <= (xStone[i]/2 + 70) && yOne >= (yStone[i]/2 -18 ) && yOne <= (yStone[i]/2 + 53)) || (yOne <= (yStone[i]/2 - 20) && yOne >= (yStone[i]/2 - 90) && xOne >= (xStone[i]/2 - 40) && xOne <= (xStone[i]/2 + 40))))
 		{	
@@ -435,10 +477,6 @@ bool checkIfSpaceShipIsSafe() {
 void SpaceshipCreate(){	
 	glPushMatrix();
 	glTranslated(xOne,yOne,0);
-	if(!checkIfSpaceShipIsSafe() && alienLife ){
-		alienLife-=10;
-		xStart -= 23;
-	}
 	DrawSpaceshipDoom();
 	glPushMatrix();
 	glTranslated(4,19,0);
@@ -545,6 +583,7 @@ void startScreenDisplay()
 }
 void GameScreenDisplay()
 {
+	PROFILE_FUNCTION();
 	SetDisplayMode(GAME_SCREEN);
 	DisplayHealthBar();
 	glScalef(2, 2 ,0);
@@ -552,6 +591,8 @@ void GameScreenDisplay()
 		SpaceshipCreate();
 	}
 	else {
+		if(!gameOver)
+			highScores.submit(Score);		//once per game
 		gameOver=true;
 		instructionsGame = false;
 		startScreen = false;
@@ -560,38 +601,6 @@ void GameScreenDisplay()
 	StoneGenerate();
 	
 }
-void readFromFile() {
-
-	FILE *fp = fopen("HighScoreFile.txt" ,"r");
-	int i=0;
-	if(fp!= NULL){
-		while(fread(&ch,sizeof(char),1 ,fp)){
-			highScore[i++] = ch;
-		}
-		highScore[i] = '\0';
-	} 
-	fclose(fp);
-}
-void writeIntoFile() {						//To write high score on to file
-	FILE *fp = fopen("HighScoreFile.txt" ,"w");
-	int i=0;
-	char temp[40];
-	if(fp!= NULL){
-		int n= Score;
-		while(n){
-			ch = (n%10)+ '0';
-			n/=10;
-			temp[i++] = ch;
-		}
-		temp[i] = '\0';
-		strrev(temp);
-		puts(temp);
-		if(temp[0] == '\0')
-			temp[i++] = '0' ,temp[i++] = '\0';
-		fwrite(temp ,sizeof(char)*i ,i ,fp);
-	}
- fclose(fp);
-}
 void GameOverScreen()
 {
 	SetDisplayMode(MENU_SCREEN);
@@ -636,13 +645,8 @@ void GameOverScreen()
 	
 	sprintf(temp,"Score : %d",Score);
 	displayRasterText(-100 ,340 ,0.4 ,temp);
-	readFromFile();
 	char temp2[40];
-	if(atoi(highScore) < Score){
-		writeIntoFile();
-		sprintf(temp2 ,"Highest Score :%d" ,Score);
-	} else 
-		sprintf(temp2 ,"Highest Score :%s" ,highScore);
+	sprintf(temp2 ,"Highest Score :%d" ,highScores.getBest());
 
 	displayRasterText(-250 ,400 ,0.4 ,temp2);
 		
@@ -675,19 +679,16 @@ void GameOverScreen()
 	displayRasterText(-100 ,-170 ,0.4 ,"    Quit");
 	
 }
-void StoneGenerate(){
-
+void updateStones() {				//one simulation step of the stones: level up, laser hits and motion
 		if(xStone[0]>=1200){      //If the last screen hits the end of screen then go to Nxt lvl
 			GameLvl++;
 			stoneTranslationSpeed+=3;
 			Score+=50;
 			initializeStoneArray();
-			GameScreenDisplay();
 		}
 
 	for(int i=0; i<MAX_STONES ;i++){
-		index = i;
-		
+
 		if(mouseX <= (xStone[i]/2+20) && mouseX >=(xStone[i]/2-20) && mouseY >= (yStone[i]/2-20) && mouseY <= (yStone[i]/2+20) && mButtonPressed){
 			if(stoneAlive[i]){   // IF ALIVE KILL STONE
 				stoneAlive[i]=0;
@@ -698,12 +699,21 @@ void StoneGenerate(){
 			}
 		}
 		xStone[i] += stoneTranslationSpeed;
-		if(stoneAlive[i] )             //stone alive
-			DrawStone(randomStoneIndices[i]);
 	}
 	stoneAngle+=stoneRotationSpeed;
 	if(stoneAngle > 360) stoneAngle = 0;
 }
+void StoneGenerate(){					//draw the live stones on screen
+	PROFILE_FUNCTION();
+
+	for(int i=0; i<MAX_STONES ;i++){
+		if(stoneAlive[i] && xStone[i] >= -1200-STONE_REACH && xStone[i] <= 1200+STONE_REACH) {	//stone alive and on screen
+			StoneInstance stone = {xStone[i] ,yStone[i] ,stoneAngle};
+			stoneInstances[randomStoneIndices[i]].push_back(stone);
+		}
+	}
+	drawStones();
+}
 void backButton() {
 	if(mouseX <= -450 && mouseX >= -500 && mouseY >= -275 && mouseY <= -250){
 			glColor3f(0, 0, 1);
@@ -736,11 +746,34 @@ void InstructionsScreenDisplay()
 		nextScreen = false ,previousScreen = false; //as set by backButton()
 
 
+}
+bool framePending = false;			//frame timer set, so further requests are already covered
+std::chrono::steady_clock::time_point nextFrameTime;	//earliest time of the next frame
+void frameTimer(int value) {
+	framePending = false;
+	glutPostRedisplay();
+}
+void requestRedraw() {				//ask for a frame; requests before it is drawn coalesce into it, and nothing is drawn while nothing asks
+	if(offscreen || framePending)
+		return;
+	framePending = true;
+	long long wait = std::chrono::duration_cast<std::chrono::milliseconds>(nextFrameTime - std::chrono::steady_clock::now()).count();
+	glutTimerFunc(wait > 0 ? (unsigned int)wait : 0 ,frameTimer ,0);
+}
+int screenState() {					//which screen display() shows, to tell when it changes
+	return startGame | gameOver << 1 | startScreen << 2 | instructionsGame << 3;
 }
 void display() {
+	PROFILE_FUNCTION();
+	int screen = screenState();
+	nextFrameTime = std::chrono::steady_clock::now() + std::chrono::microseconds(1000000/FRAME_RATE);
+	int steps = offscreen ? 0 : simClock.advance();	//offscreen runs step once per frame themselves
+	for(int k=0 ;k<steps ;k++)
+		simulationStep();
 
 	glClear(GL_COLOR_BUFFER_BIT);   
 	glViewport(0,0,1200,700);
+	beginSphereFrame();				//the spheres of the frame are sized with this view
 
 	if(startGame && !gameOver)
 		GameScreenDisplay();
@@ -773,9 +806,18 @@ void display() {
 
 	//Reset Scaling values
 	glScalef(1/2 ,1/2 ,0);
+	flushText(1200 ,700);				//all text of the frame in one draw
 	glFlush();  
 	glLoadIdentity();
-	glutSwapBuffers();
+	if(offscreen)
+		glFinish();						//wait until the frame is drawn, as the swap would
+	else
+		glutSwapBuffers();
+
+	if(mButtonReleased && (steps || !startGame || gameOver))	//the frame, and in the game a simulation step, has seen the click
+		mButtonPressed = mButtonReleased = false;
+	if((startGame && !gameOver) || screenState() != screen)	//stones keep moving, or the next screen must be drawn
+		requestRedraw();
 }
 void somethingMovedRecalculateLaserAngle() {
 
@@ -786,16 +828,40 @@ void somethingMovedRecalculateLaserAngle() {
 }
 void keys(unsigned char key, int x, int y)
 {
-	//if(key=='w' && key=='d' ){xOne+=0.5;yOne+=0.5;}
-	if(key == 'd') xOne+=SPACESHIP_SPEED; 
-	if(key == 'a') xOne-=SPACESHIP_SPEED; 
-	if(key == 'w') {yOne+=SPACESHIP_SPEED;}
-	if(key == 's') {yOne-=SPACESHIP_SPEED;}
-	if(key == 'd' || key == 'a' || key == 'w' || key == 's')
+	const char *move = key ? strchr(moveKeys ,key) : NULL;
+	if(move)							//the ship moves in the simulation steps
+		moveKeyDown[move-moveKeys] = moveKeyPressed[move-moveKeys] = true;
+	requestRedraw();
+}
+void keysUp(unsigned char key, int x, int y)
+{
+	const char *move = key ? strchr(moveKeys ,key) : NULL;
+	if(move)
+		moveKeyDown[move-moveKeys] = false;
+}
+void moveSpaceship() {				//move the ship a full step for keys tapped since the last step, at speed for keys held
+	static const float dx[4]={0,-1,0,1} ,dy[4]={1,0,-1,0};
+	bool moved = false;
+	for(int k=0 ;k<4 ;k++)
+		if(moveKeyPressed[k] || moveKeyDown[k]) {
+			float distance = moveKeyPressed[k] ? SPACESHIP_STEP : (float)SPACESHIP_SPEED/SIM_RATE;
+			xOne += dx[k]*distance;
+			yOne += dy[k]*distance;
+			moveKeyPressed[k] = false;
+			moved = true;
+		}
+	if(moved)
 		somethingMovedRecalculateLaserAngle();
-			
-	display();
-	
+}
+void simulationStep() {				//advance the game by 1/SIM_RATE s; drawing does not change the game
+	if(!startGame || gameOver)
+		return;
+	moveSpaceship();
+	if(!checkIfSpaceShipIsSafe() && alienLife ){
+		alienLife-=10;
+		xStart -= 23;
+	}
+	updateStones();
 }
 void myinit()
 {
@@ -807,6 +873,9 @@ void myinit()
     gluOrtho2D(-1200,1200,-700,700);                   //<-----CHANGE THIS TO GET EXTRA SPACE
 //  gluOrtho2D(-200,200,-200,200);
 	glMatrixMode(GL_MODELVIEW);
+	buildTextAtlas();
+	beginSphereFrame();
+	buildStoneMeshes();
 }
 void passiveMotionFunc(int x,int y) {
 
@@ -816,44 +885,102 @@ void passiveMotionFunc(int x,int y) {
 
 	//Do calculations to find value of LaserAngle
 	somethingMovedRecalculateLaserAngle();
-	display();
+	requestRedraw();
 }
  void mouseClick(int buttonPressed ,int state ,int x, int y) {
 	
 	if(buttonPressed == GLUT_LEFT_BUTTON && state == GLUT_DOWN)
-		mButtonPressed = true;
+		mButtonPressed = true ,mButtonReleased = false;
 	else 
-		mButtonPressed = false;
-	display();
+		mButtonReleased = mButtonPressed;	//cleared after the next frame, so a click between two frames still counts
+	requestRedraw();
 }
  void UpdateColorIndexForSpaceshipLights(int value)
 {
 	 CI=(CI+1)%3;			//Color Index swapping to have rotation effect
-	 display();
+	 requestRedraw();
  	 glutTimerFunc(250,UpdateColorIndexForSpaceshipLights,0);
 }
- void idleCallBack() {			//when no mouse or keybord pressed
-	 display();
+ #ifdef OFFSCREEN_RENDERING
+ //draw frames frames of a game with no window and print their times, one simulation step per frame; the
+ //stones come from stoneSeed, so every run draws the same frames. With goldenDir, GOLDEN_CHECKS of the frames are compared with
+ //the golden images there, or written there if updateGolden is set. Returns 1 if any did not match
+ int runOffscreen(int frames ,const char *goldenDir ,bool updateGolden) {
+	FrameStats frameStats;
+	GoldenCheck golden(goldenDir ? goldenDir : "." ,"spaceship" ,updateGolden);
+	double checkTime = 0;				//drawing time of the frames since the last check, in ms
+	int checkFrames = 0;
+
+	if(!createOffscreenContext(1200,700))
+		return 1;
+	glewExperimental = GL_TRUE;
+	glewInit();
+	glBlendFunc(GL_SRC_ALPHA ,GL_ONE_MINUS_SRC_ALPHA);
+	glGetIntegerv(GL_VIEWPORT ,m_viewport);
+	myinit();
+	SetDisplayMode(GAME_SCREEN);
+	initializeStoneArray();
+	startScreen = false;				//straight into the game, as after clicking Start Game
+	startGame = true;
+
+	for(int i=1 ;i<=frames ;i++) {
+		simulationStep();				//one step per frame, so every run plays the same; not timed, so the times are of the drawing only
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		frameStats.beginFrame();
+		display();
+		frameStats.endFrame();
+		checkTime += std::chrono::duration<double ,std::milli>(std::chrono::steady_clock::now() - start).count();
+		checkFrames++;
+
+		if(goldenDir && i*GOLDEN_CHECKS/frames != (i-1)*GOLDEN_CHECKS/frames) {
+			golden.check(i ,1200 ,700 ,checkTime/checkFrames);
+			checkTime = 0;
+			checkFrames = 0;
+		}
+	}
+	frameStats.report(std::cout);
+	int failures = goldenDir ? golden.finish() : 0;
+	destroyOffscreenContext();
+	return failures > 0;
  }
+ #endif
  int main(int argc, char** argv) {
+	int offscreenFrames = 0;				//--offscreen N [--golden DIR | --update-golden DIR]
+	const char *goldenDir = NULL;
+	bool updateGolden = false;
+	for(int i=1 ;i<argc ;i++) {
+		if(!strcmp(argv[i] ,"--offscreen") && i+1 < argc)
+			offscreenFrames = atoi(argv[++i]);
+		else if(!strcmp(argv[i] ,"--golden") && i+1 < argc)
+			goldenDir = argv[++i];
+		else if(!strcmp(argv[i] ,"--update-golden") && i+1 < argc)
+			goldenDir = argv[++i] ,updateGolden = true;
+	}
 	
-	 FILE *fp = fopen("HighScoreFile.txt" ,"r") ;      //check if HighScoreFile.txt exist if not create             
-	 if(fp!=NULL)
-		fclose(fp);
-	 else
-		 writeIntoFile(); 
-		 
+	if(offscreenFrames > 0) {		//benchmark the drawing with no window, and without GLUT, which needs a window system
+#ifdef OFFSCREEN_RENDERING
+		offscreen = true;
+		return runOffscreen(offscreenFrames ,goldenDir ,updateGolden);
+#else
+		printf("Built without offscreen rendering, which needs EGL.\n");
+		if(goldenDir) printf("Cannot %s the golden images in %s\n" ,updateGolden ? "update" : "check" ,goldenDir);
+		return 1;
+#endif
+	}
 	glutInit(&argc, argv);    
 	glutInitWindowSize(1200,700);
 	glutInitWindowPosition(90 ,0);
 	glutInitDisplayMode(GLUT_DOUBLE|GLUT_RGB);
 	glutTimerFunc(50,UpdateColorIndexForSpaceshipLights,0);
 	glutCreateWindow("THE SPACESHIP SHOOTING GAME");  
+	glewExperimental = GL_TRUE;			//buffer objects for the cached spheres
+	glewInit();
 	glutDisplayFunc(display); 
 	glutKeyboardFunc(keys);  
+	glutKeyboardUpFunc(keysUp);
+	glutIgnoreKeyRepeat(1);
 	glutPassiveMotionFunc(passiveMotionFunc);
 	glBlendFunc(GL_SRC_ALPHA ,GL_ONE_MINUS_SRC_ALPHA);
-	glutIdleFunc(idleCallBack);
 	glutMouseFunc(mouseClick);
 	glGetIntegerv(GL_VIEWPORT ,m_viewport);
 	myinit();
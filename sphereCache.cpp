@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Cached sphere meshes. See sphereCache.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+#include <glew.h>
+
+#include "solidShapes.h"
+#include "sphereCache.h"
+
+// A unit sphere in buffers: the vertices, then the normals, which are the same
+// numbers, and the triangle indices.
+struct SphereMesh
+{
+    unsigned int vbo, ibo;
+    int indexCount;
+    int normalsOffset; // Byte offset of the normals in vbo.
+};
+
+static std::map<std::pair<int, int>, SphereMesh> meshes; // Keyed by slices and stacks.
+
+// Function to get the mesh of a unit sphere of slices and stacks, creating it the first
+// time it is asked for.
+static const SphereMesh &getSphereMesh(int slices, int stacks)
+{
+    std::map<std::pair<int, int>, SphereMesh>::iterator found = meshes.find(std::make_pair(slices, stacks));
+    if (found != meshes.end()) return found->second;
+
+    ShapeMesh shape;
+    generateSolidSphere(1.0, slices, stacks, shape);
+
+    SphereMesh &mesh = meshes[std::make_pair(slices, stacks)];
+    int bytes = (int)(shape.vertices.size() * sizeof(float));
+    glGenBuffers(1, &mesh.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+    glBufferData(GL_ARRAY_BUFFER, 2 * bytes, NULL, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, shape.vertices.data());
+    glBufferSubData(GL_ARRAY_BUFFER, bytes, bytes, shape.normals.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenBuffers(1, &mesh.ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, shape.indices.size() * sizeof(unsigned int), shape.indices.data(),
+                 GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    mesh.indexCount = (int)shape.indices.size();
+    mesh.normalsOffset = bytes;
+    return mesh;
+}
+
+static float projection[16]; // Projection and viewport read by beginSphereFrame().
+static int viewport[4];
+
+// Function to read the projection and viewport of the frame.
+void beginSphereFrame(void)
+{
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+}
+
+// Function to cap slices and stacks by the size of the sphere on screen, rounded up to a
+// power-of-two level.
+void capSphereDetail(double radius, int &slices, int &stacks)
+{
+    if (projection[3] != 0.0 || projection[7] != 0.0 || projection[11] != 0.0) return; // Perspective.
+
+    // Pixels per unit along the wider of the two window axes.
+    float pixels = (float)radius * std::max(fabsf(projection[0]) * viewport[2], fabsf(projection[5]) * viewport[3]) / 2;
+    int needed = (int)ceil(2.0 * M_PI * pixels / SPHERE_LOD_PIXELS);
+    int level = SPHERE_MIN_SLICES;
+    while (level < needed && level < SPHERE_MAX_SLICES) level *= 2;
+
+    slices = std::min(slices, level);
+    stacks = std::min(stacks, level / 2);
+}
+
+// Function to draw an ellipsoid from the cache, with the slices and stacks capped by its size.
+void drawCachedSphere(double radiusX, double radiusY, double radiusZ, int slices, int stacks)
+{
+    if (slices < 1 || stacks < 2) return;
+
+    capSphereDetail(std::max(radiusX, std::max(radiusY, radiusZ)), slices, stacks);
+    const SphereMesh &mesh = getSphereMesh(slices, stacks);
+
+    glPushMatrix();
+    glScaled(radiusX, radiusY, radiusZ);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ibo);
+    glVertexPointer(3, GL_FLOAT, 0, (void *)0);
+    glNormalPointer(GL_FLOAT, 0, (void *)(size_t)mesh.normalsOffset);
+    glDrawElements(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, (void *)0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glPopClientAttrib();
+    glPopMatrix();
+}
@@ -0,0 +1,43 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Cached sphere meshes with a level of detail picked by size on screen.
+//
+// drawCachedSphere() draws what drawSolidSphere() (see solidShapes.h) would, scaled
+// into an ellipsoid, but each slices x stacks tessellation is generated once and kept
+// in a vertex and an index buffer, so drawing a sphere again costs one glDrawElements.
+// The slices and stacks asked for are also capped so that the sphere's outline is cut
+// into edges of about SPHERE_LOD_PIXELS pixels: a sphere a few pixels wide is drawn
+// with a few dozen triangles rather than the millions asked for.
+//
+// The size on screen is taken from the projection and viewport read once per frame by
+// beginSphereFrame() and the largest semi-axis of the ellipsoid, so drawing a sphere
+// reads nothing back from OpenGL. Any scaling must therefore be passed as the semi-axes
+// rather than set in the modelview matrix. The cap applies to orthographic projections
+// only; under a perspective projection spheres are drawn with the detail asked for.
+//
+// The cap rounds up to power-of-two levels from SPHERE_MIN_SLICES to SPHERE_MAX_SLICES
+// slices, with half as many stacks, so the cache holds at most one mesh per level for
+// each slices and stacks asked for, however the sizes on screen vary.
+//
+// Needs a current context with buffer objects (OpenGL 1.5) and GLEW initialized.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPHERE_CACHE_H
+#define SPHERE_CACHE_H
+
+#define SPHERE_LOD_PIXELS 3.0 // Wanted length of the edges around a sphere's outline, in pixels.
+#define SPHERE_MIN_SLICES 8 // Fewest slices the size cap goes down to, with half as many stacks.
+#define SPHERE_MAX_SLICES 256 // Most slices drawn, with half as many stacks, however large the sphere.
+
+// Function to read the projection and viewport the spheres are sized with, once per
+// frame or whenever either changes.
+void beginSphereFrame(void);
+
+// Function to draw an ellipsoid centered at the origin with semi-axes radiusX, radiusY
+// and radiusZ, cut into at most slices around the z axis and stacks along it.
+void drawCachedSphere(double radiusX, double radiusY, double radiusZ, int slices, int stacks);
+
+// Function to lower slices and stacks to what drawCachedSphere() would draw an
+// ellipsoid whose largest semi-axis is radius with, for meshes baked once.
+void capSphereDetail(double radius, int &slices, int &stacks);
+
+#endif
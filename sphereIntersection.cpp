@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Batch sphere intersection tests for asteroid collision.
+// See sphereIntersection.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#define GLM_FORCE_INTRINSICS
+#include <glm/simd/platform.h>
+
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include <cmath>
+
+#include "sphereIntersection.h"
+
+// Index of the lowest set bit of a non-zero mask.
+static inline int firstSetBit(unsigned int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Function to test the spheres one at a time.
+int checkSpheresIntersectionBatchScalar(float px, float py, float pz, float pr,
+                                        const float *x, const float *y, const float *z,
+                                        const float *r, int count)
+{
+    for (int k = 0; k < count; k++)
+    {
+        float dx = px - x[k], dy = py - y[k], dz = pz - z[k], rs = pr + r[k];
+        if (dx * dx + dy * dy + dz * dz <= rs * rs) return k;
+    }
+    return -1;
+}
+
+// Function to test the spheres a vector register at a time.
+int checkSpheresIntersectionBatch(float px, float py, float pz, float pr,
+                                  const float *x, const float *y, const float *z,
+                                  const float *r, int count)
+{
+    int k = 0;
+
+#if defined(__AVX512F__)
+    __m512 vx = _mm512_set1_ps(px), vy = _mm512_set1_ps(py), vz = _mm512_set1_ps(pz);
+    __m512 vr = _mm512_set1_ps(pr);
+    for (; k + 16 <= count; k += 16)
+    {
+        __m512 dx = _mm512_sub_ps(vx, _mm512_loadu_ps(x + k));
+        __m512 dy = _mm512_sub_ps(vy, _mm512_loadu_ps(y + k));
+        __m512 dz = _mm512_sub_ps(vz, _mm512_loadu_ps(z + k));
+        __m512 rs = _mm512_add_ps(vr, _mm512_loadu_ps(r + k));
+        __m512 d2 = _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(dx, dx), _mm512_mul_ps(dy, dy)),
+                                  _mm512_mul_ps(dz, dz));
+        unsigned int mask = _mm512_cmp_ps_mask(d2, _mm512_mul_ps(rs, rs), _CMP_LE_OQ);
+        if (mask) return k + firstSetBit(mask);
+    }
+#elif GLM_ARCH & GLM_ARCH_AVX_BIT
+    __m256 vx = _mm256_set1_ps(px), vy = _mm256_set1_ps(py), vz = _mm256_set1_ps(pz);
+    __m256 vr = _mm256_set1_ps(pr);
+    for (; k + 8 <= count; k += 8)
+    {
+        __m256 dx = _mm256_sub_ps(vx, _mm256_loadu_ps(x + k));
+        __m256 dy = _mm256_sub_ps(vy, _mm256_loadu_ps(y + k));
+        __m256 dz = _mm256_sub_ps(vz, _mm256_loadu_ps(z + k));
+        __m256 rs = _mm256_add_ps(vr, _mm256_loadu_ps(r + k));
+        __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                  _mm256_mul_ps(dz, dz));
+        unsigned int mask = _mm256_movemask_ps(_mm256_cmp_ps(d2, _mm256_mul_ps(rs, rs), _CMP_LE_OQ));
+        if (mask) return k + firstSetBit(mask);
+    }
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    __m128 vx = _mm_set1_ps(px), vy = _mm_set1_ps(py), vz = _mm_set1_ps(pz);
+    __m128 vr = _mm_set1_ps(pr);
+    for (; k + 4 <= count; k += 4)
+    {
+        __m128 dx = _mm_sub_ps(vx, _mm_loadu_ps(x + k));
+        __m128 dy = _mm_sub_ps(vy, _mm_loadu_ps(y + k));
+        __m128 dz = _mm_sub_ps(vz, _mm_loadu_ps(z + k));
+        __m128 rs = _mm_add_ps(vr, _mm_loadu_ps(r + k));
+        __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        unsigned int mask = _mm_movemask_ps(_mm_cmple_ps(d2, _mm_mul_ps(rs, rs)));
+        if (mask) return k + firstSetBit(mask);
+    }
+#endif
+
+    // Whatever is left over from the vector loop.
+    int hit = checkSpheresIntersectionBatchScalar(px, py, pz, pr, x + k, y + k, z + k, r + k, count - k);
+    return hit < 0 ? -1 : k + hit;
+}
+
+// Function to intersect the probe's path with each sphere grown by the probe radius.
+float sweptSphereTimeOfImpact(float px, float py, float pz, float pr,
+                              float dx, float dy, float dz,
+                              const float *x, const float *y, const float *z,
+                              const float *r, int count)
+{
+    float a = dx * dx + dy * dy + dz * dz;
+    float first = 2.0;
+
+    for (int k = 0; k < count; k++)
+    {
+        float mx = px - x[k], my = py - y[k], mz = pz - z[k], rs = pr + r[k];
+        float c = mx * mx + my * my + mz * mz - rs * rs;
+        if (c <= 0.0) return 0.0; // Already touching.
+
+        // Solve |m + t d|^2 = rs^2 for the smaller root.
+        float b = mx * dx + my * dy + mz * dz;
+        if (b >= 0.0 || a == 0.0) continue; // Not moving towards the sphere.
+        float disc = b * b - a * c;
+        if (disc < 0.0) continue;
+        float t = (-b - sqrtf(disc)) / a;
+        if (t < first) first = t;
+    }
+    return first;
+}
+
+// Function to name the vector path compiled in.
+const char *sphereIntersectionPath()
+{
+#if defined(__AVX512F__)
+    return "AVX-512 (16 wide)";
+#elif GLM_ARCH & GLM_ARCH_AVX_BIT
+    return "AVX (8 wide)";
+#elif GLM_ARCH & GLM_ARCH_SSE2_BIT
+    return "SSE2 (4 wide)";
+#else
+    return "scalar";
+#endif
+}
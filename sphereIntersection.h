@@ -0,0 +1,35 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Batch sphere intersection tests for asteroid collision.
+//
+// One probe sphere is tested against a run of spheres stored as separate x/y/z/radius
+// arrays, 16, 8 or 4 spheres per instruction on AVX-512, AVX and SSE2 builds. The
+// instruction set is picked at compile time through GLM's glm/simd/platform.h.
+// A swept test gives the first contact of a moving probe.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SPHERE_INTERSECTION_H
+#define SPHERE_INTERSECTION_H
+
+// Index of the first of count spheres that intersects the probe sphere centered at
+// (px,py,pz) with radius pr, or -1 if none does.
+int checkSpheresIntersectionBatch(float px, float py, float pz, float pr,
+                                  const float *x, const float *y, const float *z,
+                                  const float *r, int count);
+
+// Scalar fallback of checkSpheresIntersectionBatch(), used for the tail of a run.
+int checkSpheresIntersectionBatchScalar(float px, float py, float pz, float pr,
+                                        const float *x, const float *y, const float *z,
+                                        const float *r, int count);
+
+// Earliest time t in [0, 1] at which the probe sphere moving from (px,py,pz) to
+// (px+dx,py+dy,pz+dz) touches one of count spheres, or a value above 1 if it never
+// does. A probe that already overlaps a sphere gives 0.
+float sweptSphereTimeOfImpact(float px, float py, float pz, float pr,
+                              float dx, float dy, float dz,
+                              const float *x, const float *y, const float *z,
+                              const float *r, int count);
+
+// Name of the vector path compiled in, e.g. "AVX (8 wide)".
+const char *sphereIntersectionPath();
+
+#endif
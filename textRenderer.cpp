@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Batched bitmap text from a glyph atlas. See textRenderer.h.
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include <GL/gl.h>
+
+#include "bitmapFontData.h"
+#include "textRenderer.h"
+
+#define ATLAS_WIDTH 256 // Width of the atlas texture; its height is what the glyphs need.
+
+// Where a glyph is in the atlas.
+struct AtlasGlyph
+{
+    int width; // Also the advance.
+    float u0, v0, u1, v1;
+};
+
+// One glyph of a laid out string.
+struct GlyphQuad
+{
+    int x; // Left edge, in pixels from the first glyph's.
+    const AtlasGlyph *glyph;
+};
+
+// Vertex of the text batch, in window coordinates.
+struct TextVertex
+{
+    float x, y, z;
+    float u, v;
+    unsigned char color[4];
+};
+
+static const BitmapFontData *fonts[TEXT_FONT_COUNT] = { &timesRoman24Font, &helvetica18Font };
+static AtlasGlyph atlasGlyphs[TEXT_FONT_COUNT][FONT_GLYPHS];
+static unsigned int atlasTexture;
+static std::unordered_map<std::string, std::vector<GlyphQuad> > layouts; // Keyed by font and string.
+static std::vector<TextVertex> batch; // Quads queued for flushText().
+
+// Function to pack every glyph of every font into rows of the atlas and upload it.
+void buildTextAtlas(void)
+{
+    std::vector<unsigned char> pixels;
+    int x = 0, y = 0, rowHeight = 0, atlasHeight = 1;
+
+    // Place the glyphs, one pixel apart so nearest sampling never bleeds.
+    struct Placement { int x, y; };
+    Placement placements[TEXT_FONT_COUNT][FONT_GLYPHS];
+    for (int f = 0; f < TEXT_FONT_COUNT; f++)
+        for (int c = 0; c < FONT_GLYPHS; c++)
+        {
+            int width = fonts[f]->glyphs[fonts[f]->offsets[c]];
+            if (x + width > ATLAS_WIDTH)
+            {
+                x = 0;
+                y += rowHeight + 1;
+                rowHeight = 0;
+            }
+            placements[f][c].x = x;
+            placements[f][c].y = y;
+            x += width + 1;
+            if (fonts[f]->height > rowHeight) rowHeight = fonts[f]->height;
+        }
+    while (atlasHeight < y + rowHeight) atlasHeight *= 2;
+
+    // Expand the bits to one alpha byte per pixel; rows go bottom up, as in glBitmap.
+    pixels.assign(ATLAS_WIDTH * atlasHeight, 0);
+    for (int f = 0; f < TEXT_FONT_COUNT; f++)
+        for (int c = 0; c < FONT_GLYPHS; c++)
+        {
+            const unsigned char *glyph = fonts[f]->glyphs + fonts[f]->offsets[c];
+            int width = glyph[0], rowBytes = (width + 7) / 8;
+            const Placement &place = placements[f][c];
+
+            for (int row = 0; row < fonts[f]->height; row++)
+                for (int column = 0; column < width; column++)
+                    if (glyph[1 + row * rowBytes + column / 8] & (0x80 >> (column % 8)))
+                        pixels[(place.y + row) * ATLAS_WIDTH + place.x + column] = 255;
+
+            AtlasGlyph &atlasGlyph = atlasGlyphs[f][c];
+            atlasGlyph.width = width;
+            atlasGlyph.u0 = (float)place.x / ATLAS_WIDTH;
+            atlasGlyph.v0 = (float)place.y / atlasHeight;
+            atlasGlyph.u1 = (float)(place.x + width) / ATLAS_WIDTH;
+            atlasGlyph.v1 = (float)(place.y + fonts[f]->height) / atlasHeight;
+        }
+
+    glGenTextures(1, &atlasTexture);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, ATLAS_WIDTH, atlasHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, pixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+// Function to get the cached layout of string in font, laying it out if it is new.
+static const std::vector<GlyphQuad> &layoutText(TextFont font, const char *string)
+{
+    std::string key(1, (char)font);
+    key += string;
+
+    std::unordered_map<std::string, std::vector<GlyphQuad> >::iterator found = layouts.find(key);
+    if (found != layouts.end()) return found->second;
+
+    if (layouts.size() >= TEXT_LAYOUT_CACHE) layouts.clear();
+    std::vector<GlyphQuad> &quads = layouts[key];
+    int x = 0;
+    for (const char *c = string; *c != '\0'; c++)
+    {
+        if (*c < ' ' || *c > '~') continue;
+        GlyphQuad quad;
+        quad.x = x;
+        quad.glyph = &atlasGlyphs[font][*c - ' '];
+        quads.push_back(quad);
+        x += quad.glyph->width;
+    }
+    return quads;
+}
+
+// Function to queue a string at the window position of (x, y, z).
+void drawText(TextFont font, float x, float y, float z, const char *string)
+{
+    float modelview[16], projection[16], color[4], clip[4];
+    int viewport[4];
+
+    glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+    glGetFloatv(GL_PROJECTION_MATRIX, projection);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glGetFloatv(GL_CURRENT_COLOR, color);
+
+    // Clip coordinates of the point, projection * modelview * (x, y, z, 1).
+    float eye[4];
+    for (int r = 0; r < 4; r++)
+        eye[r] = modelview[r] * x + modelview[4 + r] * y + modelview[8 + r] * z + modelview[12 + r];
+    for (int r = 0; r < 4; r++)
+        clip[r] = projection[r] * eye[0] + projection[4 + r] * eye[1] + projection[8 + r] * eye[2] +
+                  projection[12 + r] * eye[3];
+    for (int r = 0; r < 3; r++)
+        if (clip[r] < -clip[3] || clip[r] > clip[3]) return; // glRasterPos would be invalid.
+
+    // Lower left corner of the first glyph, as glBitmap places it.
+    const BitmapFontData *data = fonts[font];
+    float left = floor(viewport[0] + (clip[0] / clip[3] + 1.0) * 0.5 * viewport[2] - data->xorig);
+    float bottom = floor(viewport[1] + (clip[1] / clip[3] + 1.0) * 0.5 * viewport[3] - data->yorig);
+    float depth = (clip[2] / clip[3] + 1.0) * 0.5;
+
+    TextVertex vertex;
+    vertex.z = depth;
+    for (int c = 0; c < 3; c++) vertex.color[c] = (unsigned char)(color[c] * 255.0 + 0.5);
+    vertex.color[3] = 255;
+
+    const std::vector<GlyphQuad> &quads = layoutText(font, string);
+    for (size_t k = 0; k < quads.size(); k++)
+    {
+        const AtlasGlyph &glyph = *quads[k].glyph;
+        float x0 = left + quads[k].x, x1 = x0 + glyph.width, y1 = bottom + data->height;
+
+        vertex.x = x0; vertex.y = bottom; vertex.u = glyph.u0; vertex.v = glyph.v0;
+        batch.push_back(vertex);
+        vertex.x = x1; vertex.u = glyph.u1;
+        batch.push_back(vertex);
+        vertex.y = y1; vertex.v = glyph.v1;
+        batch.push_back(vertex);
+        vertex.x = x0; vertex.u = glyph.u0;
+        batch.push_back(vertex);
+    }
+}
+
+// Function to draw the queued quads in window coordinates. Glyph pixels keep the depth
+// of their raster position, and pixels outside the glyphs are discarded by the alpha
+// test, as glBitmap leaves them untouched.
+void flushText(int width, int height)
+{
+    if (batch.empty()) return;
+
+    glPushAttrib(GL_ENABLE_BIT | GL_VIEWPORT_BIT | GL_TEXTURE_BIT | GL_COLOR_BUFFER_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+    glViewport(0, 0, width, height);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0.0, width, 0.0, height, 0.0, -1.0); // z is the window depth.
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+
+    glDisable(GL_LIGHTING);
+    glEnable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, atlasTexture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GREATER, 0.5);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(TextVertex), &batch[0].x);
+    glTexCoordPointer(2, GL_FLOAT, sizeof(TextVertex), &batch[0].u);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(TextVertex), batch[0].color);
+    glDrawArrays(GL_QUADS, 0, (int)batch.size());
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glPopClientAttrib();
+    glPopAttrib();
+    batch.clear();
+}
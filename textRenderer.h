@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Batched bitmap text from a glyph atlas, replacing glutBitmapCharacter.
+//
+// The glyphs of the GLUT bitmap fonts are packed once into one alpha texture.
+// drawText() places a string exactly where glRasterPos3f and glutBitmapCharacter
+// would, in the current color, and queues one textured quad per glyph; flushText()
+// then draws all text queued in the frame with a single call. String layouts are
+// cached, so text that does not change costs a lookup per frame.
+//
+// Needs no GLUT and no extensions beyond OpenGL 1.1, so it also works in offscreen
+// contexts (see offscreenContext.h). No vertex buffer may be bound when text is flushed.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TEXT_RENDERER_H
+#define TEXT_RENDERER_H
+
+#define TEXT_LAYOUT_CACHE 256 // Layouts kept before the cache is emptied, e.g. for changing scores.
+
+// Fonts of the atlas, the GLUT bitmap fonts of the same names.
+enum TextFont
+{
+    TEXT_TIMES_ROMAN_24,
+    TEXT_HELVETICA_18,
+    TEXT_FONT_COUNT
+};
+
+// Function to create the atlas texture. Needs a current context; call once.
+void buildTextAtlas(void);
+
+// Function to queue string to be drawn as glRasterPos3f(x, y, z) followed by
+// glutBitmapCharacter() for each character would draw it, with the current color,
+// matrices and viewport. Like glRasterPos, nothing is drawn if (x, y, z) is clipped.
+// Characters outside printable ASCII are skipped.
+void drawText(TextFont font, float x, float y, float z, const char *string);
+
+// Function to draw all queued text in one call, over a width x height window, and
+// empty the queue. Call once per frame before the swap. GL state is left as it was.
+void flushText(int width, int height);
+
+#endif
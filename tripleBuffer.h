@@ -0,0 +1,55 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Lock-free triple buffer for handing snapshots from one writer thread to one reader
+// thread.
+//
+// The writer fills its back buffer and publishes it; the reader picks up the newest
+// published buffer whenever it likes. Neither side ever waits for the other: a slow
+// reader only skips snapshots and a slow writer only leaves the reader on the last one.
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+
+template <typename T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() : middle(1)
+    {
+        back = 0;
+        front = 2;
+    }
+
+    // Buffer the writer fills before calling publish().
+    T &writeBuffer() { return buffers[back]; }
+
+    // Writer: hand the back buffer over as the newest snapshot.
+    void publish()
+    {
+        back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Reader: switch to the newest snapshot if one was published since the last call.
+    // Returns true if the read buffer changed.
+    bool update()
+    {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+
+    // Snapshot the reader is looking at.
+    const T &readBuffer() const { return buffers[front]; }
+
+private:
+    enum { INDEX = 3, FRESH = 4 }; // The middle slot holds a buffer index and a "not read yet" flag.
+
+    T buffers[3];
+    std::atomic<int> middle; // Buffer in between, swapped by both sides.
+    int back; // Owned by the writer.
+    int front; // Owned by the reader.
+};
+
+#endif